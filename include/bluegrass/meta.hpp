@@ -1,5 +1,23 @@
 #pragma once
 
+#include "meta/columnar.hpp"
+#include "meta/compare.hpp"
 #include "meta/function_traits.hpp"
+#include "meta/hash.hpp"
+#include "meta/json.hpp"
+#include "meta/kernels.hpp"
+#include "meta/lazy.hpp"
+#include "meta/lookup.hpp"
+#include "meta/methods.hpp"
+#include "meta/parallel.hpp"
+#include "meta/patch.hpp"
 #include "meta/refl.hpp"
+#include "meta/registry.hpp"
+#include "meta/rpc.hpp"
+#include "meta/schema.hpp"
+#include "meta/serialize.hpp"
+#include "meta/soa.hpp"
+#include "meta/tracked.hpp"
 #include "meta/utility.hpp"
+#include "meta/versioned.hpp"
+#include "meta/view.hpp"
@@ -0,0 +1,380 @@
+#pragma once
+
+#include "refl.hpp"
+#include "schema.hpp"
+#include "serialize.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * \file columnar.hpp
+ * Columnar file format for streams of reflected records, read back through mmap.
+ *
+ * Layout (native byte order):
+ *    - 8 byte magic
+ *    - blocks: every field of up to block_rows records stored as one contiguous column, each column
+ *      starting at a multiple of columnar_alignment so it can be used in place
+ *    - footer: the serialize.hpp encoding of columnar_footer, i.e. the schema (names, normalized type
+ *      names and sizes of the meta_hierarchy fields) and the row count and column offsets of every block
+ *    - trailer: uint64 footer offset, 8 byte magic
+ *
+ * Only records whose fields are all trivially copyable can be stored, the reader hands out spans
+ * into the mapping and never copies a column.
+ */
+
+namespace bluegrass { namespace meta {
+   constexpr static inline std::size_t columnar_alignment = 64;
+
+   struct columnar_field {
+      std::string   name;
+      std::string   type;
+      std::uint32_t size = 0;
+      META_REFL(name, type, size);
+   };
+
+   struct columnar_block {
+      std::uint64_t              rows = 0;
+      std::vector<std::uint64_t> offsets;
+      META_REFL(rows, offsets);
+   };
+
+   struct columnar_footer {
+      std::uint64_t               fingerprint = 0;
+      std::string                 type;
+      std::vector<columnar_field> fields;
+      std::vector<columnar_block> blocks;
+      META_REFL(fingerprint, type, fields, blocks);
+   };
+
+   namespace detail {
+      constexpr static inline std::array<char, 8> columnar_magic = {'B', 'G', 'C', 'O', 'L', '0', '0', '1'};
+      constexpr static inline std::size_t columnar_trailer_size = sizeof(std::uint64_t) + columnar_magic.size();
+
+      template <typename C, std::size_t... Is>
+      constexpr inline bool columnar_storable(std::index_sequence<Is...>) {
+         return ((std::is_trivially_copyable_v<typename meta_hierarchy<C>::template type<Is>> &&
+                  !is_string_view<typename meta_hierarchy<C>::template type<Is>>::value &&
+                  !is_address<typename meta_hierarchy<C>::template type<Is>>::value) && ...);
+      }
+
+      template <typename C, std::size_t... Is>
+      inline std::vector<columnar_field> columnar_fields(std::index_sequence<Is...>) {
+         using meta_t = meta_hierarchy<C>;
+         return { columnar_field{ std::string(meta_t::names[Is]),
+                                  std::string(normalized_type_name<typename meta_t::template type<Is>>()),
+                                  static_cast<std::uint32_t>(sizeof(typename meta_t::template type<Is>)) }... };
+      }
+
+      template <typename C, std::size_t... Is>
+      constexpr inline auto columnar_sizes(std::index_sequence<Is...>) {
+         return std::array<std::size_t, sizeof...(Is)>{ sizeof(typename meta_hierarchy<C>::template type<Is>)... };
+      }
+
+      template <typename Types>
+      struct column_vectors;
+
+      template <typename... Ts>
+      struct column_vectors<std::tuple<Ts...>> {
+         static_assert(!(std::is_same_v<Ts, bool> || ...), "bool fields can't be buffered in a contiguous std::vector column");
+         using type = std::tuple<std::vector<Ts>...>;
+      };
+
+      inline std::system_error columnar_errno(const char* what) {
+         return std::system_error(errno, std::generic_category(), what);
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * \class columnar_writer
+    * Appends records of T to a columnar file, a block is written every block_rows records and the
+    * footer by close() (or the destructor).
+    */
+   template <typename T>
+   class columnar_writer {
+      public:
+         using meta_t = meta_hierarchy<T>;
+         constexpr static inline std::size_t cardinality = meta_t::cardinality;
+
+         static_assert(detail::is_reflected_v<T>, "columnar_writer requires a reflected type");
+         static_assert(detail::columnar_storable<T>(std::make_index_sequence<cardinality>{}),
+                       "columnar files only store trivially copyable fields, and no pointers");
+
+         explicit columnar_writer(const std::string& path, std::size_t block_rows = 64 * 1024)
+            : _file(std::fopen(path.c_str(), "wb")), _block_rows(block_rows) {
+            if (_file == nullptr)
+               throw detail::columnar_errno("columnar_writer: can't open file");
+            try {
+               _footer.fingerprint = schema_fingerprint_v<T>;
+               _footer.type        = std::string(normalized_type_name<T>());
+               _footer.fields      = detail::columnar_fields<T>(std::make_index_sequence<cardinality>{});
+               reserve(_block_rows);
+               write(detail::columnar_magic.data(), detail::columnar_magic.size());
+            } catch (...) {
+               std::fclose(_file);
+               throw;
+            }
+         }
+
+         columnar_writer(const columnar_writer&) = delete;
+         columnar_writer& operator=(const columnar_writer&) = delete;
+
+         ~columnar_writer() {
+            try {
+               close();
+            } catch (...) {
+               // call close() to observe write errors
+            }
+         }
+
+         inline void append(const T& v) {
+            append_impl(v, std::make_index_sequence<cardinality>{});
+            if (pending() == _block_rows)
+               flush();
+         }
+
+         /**
+          * Write the buffered records as a block.
+          */
+         inline void flush() {
+            if (pending() == 0)
+               return;
+            columnar_block block;
+            block.rows = pending();
+            std::apply([&](auto&... cols) { (block.offsets.push_back(write_column(cols)), ...); }, _columns);
+            std::apply([](auto&... cols) { (cols.clear(), ...); }, _columns);
+            _rows += block.rows;
+            _footer.blocks.push_back(std::move(block));
+         }
+
+         /**
+          * Flush and write the footer, the writer can't be appended to afterwards.
+          */
+         inline void close() {
+            if (_file == nullptr)
+               return;
+            flush();
+            const std::uint64_t footer_offset = _pos;
+            std::vector<std::byte> footer(serialized_size(_footer));
+            serialize(_footer, footer);
+            write(footer.data(), footer.size());
+            write(&footer_offset, sizeof(footer_offset));
+            write(detail::columnar_magic.data(), detail::columnar_magic.size());
+            std::FILE* f = std::exchange(_file, nullptr);
+            if (std::fclose(f) != 0)
+               throw detail::columnar_errno("columnar_writer: can't close file");
+         }
+
+         inline std::size_t size() const { return _rows + pending(); }
+
+      private:
+         inline std::size_t pending() const { return std::get<0>(_columns).size(); }
+
+         inline void reserve(std::size_t n) {
+            std::apply([n](auto&... cols) { (cols.reserve(n), ...); }, _columns);
+         }
+
+         template <std::size_t... Is>
+         inline void append_impl(const T& v, std::index_sequence<Is...>) {
+            (std::get<Is>(_columns).push_back(meta_t::template get<Is>(v)), ...);
+         }
+
+         template <typename Column>
+         inline std::uint64_t write_column(const Column& col) {
+            constexpr std::array<std::byte, columnar_alignment> zeros = {};
+            write(zeros.data(), (columnar_alignment - _pos % columnar_alignment) % columnar_alignment);
+            const std::uint64_t offset = _pos;
+            write(col.data(), col.size() * sizeof(typename Column::value_type));
+            return offset;
+         }
+
+         inline void write(const void* src, std::size_t n) {
+            if (n != 0 && std::fwrite(src, 1, n, _file) != n)
+               throw detail::columnar_errno("columnar_writer: write failed");
+            _pos += n;
+         }
+
+         std::FILE*      _file = nullptr;
+         std::size_t     _block_rows;
+         std::uint64_t   _pos  = 0;
+         std::size_t     _rows = 0;
+         columnar_footer _footer;
+         typename detail::column_vectors<typename meta_t::types>::type _columns;
+   };
+
+   /**
+    * \class columnar_file
+    * Read only mapping of a columnar file written for T, columns are spans into the mapping.
+    * Throws std::invalid_argument when the file isn't columnar or was written with another schema
+    * and std::out_of_range when a block lies past the end of the file.
+    */
+   template <typename T>
+   class columnar_file {
+      public:
+         using meta_t = meta_hierarchy<T>;
+         template <std::size_t N>
+         using type = typename meta_t::template type<N>;
+         constexpr static inline std::size_t cardinality = meta_t::cardinality;
+
+         static_assert(detail::is_reflected_v<T>, "columnar_file requires a reflected type");
+         // columns are reinterpreted straight from the mapped bytes
+         static_assert(detail::columnar_storable<T>(std::make_index_sequence<cardinality>{}),
+                       "columnar files only store trivially copyable fields, and no pointers");
+
+         explicit columnar_file(const std::string& path) {
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+               throw detail::columnar_errno("columnar_file: can't open file");
+            struct stat st;
+            if (::fstat(fd, &st) != 0) {
+               const auto err = detail::columnar_errno("columnar_file: can't stat file");
+               ::close(fd);
+               throw err;
+            }
+            _size = static_cast<std::size_t>(st.st_size);
+            if (_size != 0) {
+               void* data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+               if (data == MAP_FAILED) {
+                  const auto err = detail::columnar_errno("columnar_file: can't map file");
+                  ::close(fd);
+                  throw err;
+               }
+               _data = static_cast<const std::byte*>(data);
+            }
+            ::close(fd);
+            try {
+               read_footer();
+            } catch (...) {
+               unmap();
+               throw;
+            }
+         }
+
+         columnar_file(columnar_file&& o) noexcept
+            : _data(std::exchange(o._data, nullptr)), _size(std::exchange(o._size, 0)),
+              _rows(o._rows), _footer(std::move(o._footer)) {}
+
+         columnar_file& operator=(columnar_file&& o) noexcept {
+            if (this != &o) {
+               unmap();
+               _data   = std::exchange(o._data, nullptr);
+               _size   = std::exchange(o._size, 0);
+               _rows   = o._rows;
+               _footer = std::move(o._footer);
+            }
+            return *this;
+         }
+
+         ~columnar_file() { unmap(); }
+
+         inline std::size_t size() const { return _rows; }
+         inline std::size_t block_count() const { return _footer.blocks.size(); }
+         inline std::size_t block_size(std::size_t block) const { return _footer.blocks[block].rows; }
+         inline const columnar_footer& footer() const { return _footer; }
+
+         /**
+          * Field N of the records of block, without copying.
+          */
+         template <std::size_t N>
+         inline span<const type<N>> column(std::size_t block) const {
+            const auto& b = _footer.blocks[block];
+            return { reinterpret_cast<const type<N>*>(_data + b.offsets[N]), static_cast<std::size_t>(b.rows) };
+         }
+
+         /**
+          * Call f(span<const type<N>>) for field N of every block in order.
+          */
+         template <std::size_t N, typename F>
+         inline void for_each_block(F&& f) const {
+            for (std::size_t b=0; b < block_count(); b++)
+               f(column<N>(b));
+         }
+
+         /**
+          * Record i, gathered from its columns, i must be less than size().
+          */
+         inline T operator[](std::size_t i) const {
+            std::size_t b = 0;
+            for (; i >= _footer.blocks[b].rows; b++)
+               i -= _footer.blocks[b].rows;
+            T v;
+            gather(v, b, i, std::make_index_sequence<cardinality>{});
+            return v;
+         }
+
+         /**
+          * Record i, throws std::out_of_range if i isn't less than size().
+          */
+         inline T at(std::size_t i) const {
+            if (i >= _rows)
+               throw std::out_of_range("columnar_file: record index out of range");
+            return (*this)[i];
+         }
+
+      private:
+         template <std::size_t... Is>
+         inline void gather(T& v, std::size_t b, std::size_t i, std::index_sequence<Is...>) const {
+            ((meta_t::template get<Is>(v) = column<Is>(b)[i]), ...);
+         }
+
+         inline void read_footer() {
+            constexpr auto& magic = detail::columnar_magic;
+            if (_size < magic.size() + detail::columnar_trailer_size ||
+                std::memcmp(_data, magic.data(), magic.size()) != 0 ||
+                std::memcmp(_data + _size - magic.size(), magic.data(), magic.size()) != 0)
+               throw std::invalid_argument("columnar_file: not a columnar file");
+
+            std::uint64_t footer_offset;
+            std::memcpy(&footer_offset, _data + _size - detail::columnar_trailer_size, sizeof(footer_offset));
+            if (footer_offset > _size - detail::columnar_trailer_size)
+               throw std::out_of_range("columnar_file: footer offset past the end of the file");
+            deserialize(_footer, span<const std::byte>{_data + footer_offset, _size - detail::columnar_trailer_size - footer_offset});
+            constexpr auto sizes = detail::columnar_sizes<T>(std::make_index_sequence<cardinality>{});
+            if (_footer.fingerprint != schema_fingerprint_v<T> || _footer.fields.size() != cardinality)
+               throw std::invalid_argument("columnar_file: written with another schema");
+            for (std::size_t f=0; f < cardinality; f++)
+               if (_footer.fields[f].size != sizes[f])
+                  throw std::invalid_argument("columnar_file: field size doesn't match the schema");
+
+            for (const auto& b : _footer.blocks) {
+               if (b.offsets.size() != cardinality)
+                  throw std::invalid_argument("columnar_file: block without a column per field");
+               for (std::size_t f=0; f < cardinality; f++) {
+                  if (b.offsets[f] % columnar_alignment != 0 ||
+                      b.offsets[f] > footer_offset || b.rows > (footer_offset - b.offsets[f]) / sizes[f])
+                     throw std::out_of_range("columnar_file: column past the end of the blocks");
+               }
+               _rows += b.rows;
+            }
+         }
+
+         inline void unmap() {
+            if (_data != nullptr)
+               ::munmap(const_cast<std::byte*>(_data), _size);
+            _data = nullptr;
+         }
+
+         const std::byte* _data = nullptr;
+         std::size_t      _size = 0;
+         std::size_t      _rows = 0;
+         columnar_footer  _footer;
+   };
+}} // ns bluegrass::meta
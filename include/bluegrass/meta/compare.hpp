@@ -0,0 +1,188 @@
+#pragma once
+
+#include "refl.hpp"
+#include "serialize.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file compare.hpp
+ * Reflection derived equality and ordering.
+ *
+ * Fields are visited in meta_hierarchy order, base class fields first. Runs of adjacent, padding
+ * free integral, enum or bitwise reflected fields (meta_hierarchy<T>::bitwise_runs) are
+ * checked with a single memcmp, other classes are compared with their operator==; compare() only falls back to the fields of a run when that memcmp
+ * finds a difference, since byte order is not value order for multi byte integers.
+ */
+
+/**
+ * Opt-in comparison operators, place inside the class definition next to META_REFL.
+ * Defined as hidden friends so they are only found through ADL on CLS, derived classes need their own.
+ */
+#define META_REFL_OPERATORS(CLS)                                                                                      \
+   friend inline bool operator==(const CLS& a, const CLS& b) { return ::bluegrass::meta::equal(a, b); }               \
+   friend inline bool operator!=(const CLS& a, const CLS& b) { return !::bluegrass::meta::equal(a, b); }              \
+   friend inline bool operator<(const CLS& a, const CLS& b) { return ::bluegrass::meta::compare(a, b) < 0; }          \
+   friend inline bool operator<=(const CLS& a, const CLS& b) { return ::bluegrass::meta::compare(a, b) <= 0; }        \
+   friend inline bool operator>(const CLS& a, const CLS& b) { return ::bluegrass::meta::compare(a, b) > 0; }          \
+   friend inline bool operator>=(const CLS& a, const CLS& b) { return ::bluegrass::meta::compare(a, b) >= 0; }
+
+namespace bluegrass { namespace meta {
+   namespace detail {
+      template <typename T>
+      inline bool equal_value(const T& a, const T& b);
+
+      template <typename T>
+      inline int compare_value(const T& a, const T& b);
+
+      template <typename C>
+      inline const char* run_bytes(const C& c, const field_run& run) {
+         return reinterpret_cast<const char*>(&c) + run.offset;
+      }
+
+      template <typename C, std::size_t I>
+      inline bool equal_field(const C& a, const C& b) {
+         using meta_t = meta_hierarchy<C>;
+         if constexpr (meta_t::bitwise_run_heads[I] != 0) {
+            constexpr auto run = meta_t::bitwise_runs[meta_t::bitwise_run_heads[I]-1];
+            return std::memcmp(run_bytes(a, run), run_bytes(b, run), run.size) == 0;
+         } else if constexpr (is_bitwise<typename meta_t::template field_type<I>>()) {
+            return true; // covered by the run that contains it
+         } else {
+            return equal_value(meta_t::template get<I>(a), meta_t::template get<I>(b));
+         }
+      }
+
+      template <typename C, std::size_t... Is>
+      inline bool equal_fields(const C& a, const C& b, std::index_sequence<Is...>) {
+         return (equal_field<C, Is>(a, b) && ...);
+      }
+
+      template <typename C, std::size_t First, std::size_t... Is>
+      inline int compare_run(const C& a, const C& b, std::index_sequence<Is...>) {
+         using meta_t = meta_hierarchy<C>;
+         int r = 0;
+         (void)(((r = compare_value(meta_t::template get<First+Is>(a), meta_t::template get<First+Is>(b))) == 0) && ...);
+         return r;
+      }
+
+      template <typename C, std::size_t I>
+      inline int compare_field(const C& a, const C& b) {
+         using meta_t = meta_hierarchy<C>;
+         if constexpr (meta_t::bitwise_run_heads[I] != 0) {
+            constexpr auto run = meta_t::bitwise_runs[meta_t::bitwise_run_heads[I]-1];
+            if (std::memcmp(run_bytes(a, run), run_bytes(b, run), run.size) == 0)
+               return 0;
+            return compare_run<C, I>(a, b, std::make_index_sequence<run.count>{});
+         } else if constexpr (is_bitwise<typename meta_t::template field_type<I>>()) {
+            return 0; // covered by the run that contains it
+         } else {
+            return compare_value(meta_t::template get<I>(a), meta_t::template get<I>(b));
+         }
+      }
+
+      template <typename C, std::size_t... Is>
+      inline int compare_fields(const C& a, const C& b, std::index_sequence<Is...>) {
+         int r = 0;
+         (void)(((r = compare_field<C, Is>(a, b)) == 0) && ...);
+         return r;
+      }
+
+      template <typename T, std::size_t... Is>
+      inline bool equal_tuple(const T& a, const T& b, std::index_sequence<Is...>) {
+         return (equal_value(std::get<Is>(a), std::get<Is>(b)) && ...);
+      }
+
+      template <typename T, std::size_t... Is>
+      inline int compare_tuple(const T& a, const T& b, std::index_sequence<Is...>) {
+         int r = 0;
+         (void)(((r = compare_value(std::get<Is>(a), std::get<Is>(b))) == 0) && ...);
+         return r;
+      }
+
+      template <typename T>
+      inline bool equal_value(const T& a, const T& b) {
+         if constexpr (is_reflected_v<T>) {
+            return equal_fields(a, b, std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+         } else if constexpr (is_tuple_v<T>) {
+            return equal_tuple(a, b, std::make_index_sequence<std::tuple_size_v<T>>{});
+         } else if constexpr (is_bool_vector<T>::value) {
+            return a == b;
+         } else if constexpr (is_vector<T>::value || is_std_array<T>::value) {
+            using elem_t = typename T::value_type;
+            if (a.size() != b.size())
+               return false;
+            if constexpr (is_bitwise<elem_t>()) {
+               return a.size() == 0 || std::memcmp(a.data(), b.data(), a.size() * sizeof(elem_t)) == 0;
+            } else {
+               for (std::size_t i=0; i < a.size(); i++)
+                  if (!equal_value(a[i], b[i]))
+                     return false;
+               return true;
+            }
+         } else {
+            return a == b;
+         }
+      }
+
+      template <typename T>
+      inline int compare_value(const T& a, const T& b) {
+         if constexpr (is_reflected_v<T>) {
+            return compare_fields(a, b, std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+         } else if constexpr (is_tuple_v<T>) {
+            return compare_tuple(a, b, std::make_index_sequence<std::tuple_size_v<T>>{});
+         } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            const int r = std::string_view{a}.compare(std::string_view{b});
+            return (r > 0) - (r < 0);
+         } else if constexpr (is_vector<T>::value || is_std_array<T>::value) {
+            const std::size_t n = a.size() < b.size() ? a.size() : b.size();
+            for (std::size_t i=0; i < n; i++)
+               if (const int r = compare_value(a[i], b[i]); r != 0)
+                  return r;
+            return (a.size() > b.size()) - (a.size() < b.size());
+         } else {
+            return (b < a) - (a < b);
+         }
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * Field wise equality over the whole hierarchy of T.
+    */
+   template <typename T>
+   inline bool equal(const T& a, const T& b) {
+      return detail::equal_value(a, b);
+   }
+
+   /**
+    * Lexicographic three way comparison over the whole hierarchy of T, bases first.
+    * @return negative if a < b, 0 if neither is less than the other, positive if a > b
+    */
+   template <typename T>
+   inline int compare(const T& a, const T& b) {
+      return detail::compare_value(a, b);
+   }
+
+   /**
+    * \struct equal_to
+    * Drop in replacement for std::equal_to, pairs with meta::hash<T>.
+    */
+   template <typename T>
+   struct equal_to {
+      inline bool operator()(const T& a, const T& b) const { return equal(a, b); }
+   };
+
+   /**
+    * \struct less
+    * Drop in replacement for std::less, i.e. std::set<foo, meta::less<foo>>.
+    */
+   template <typename T>
+   struct less {
+      inline bool operator()(const T& a, const T& b) const { return compare(a, b) < 0; }
+   };
+}} // ns bluegrass::meta
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "refl.hpp"
+#include "serialize.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file hash.hpp
+ * Reflection derived hashing.
+ *
+ * Every reflected field is combined, base class fields first. Runs of adjacent, padding free
+ * integral, enum or bitwise reflected fields (meta_hierarchy<T>::bitwise_runs) are hashed as a
+ * single byte range with wyhash, other classes with their std::hash so that values equal by their
+ * operator== hash equal. Floating point values are hashed so that 0.0 and -0.0 collide.
+ */
+
+namespace bluegrass { namespace meta {
+   namespace detail {
+      // wyhash (final version 4) by Wang Yi, released into the public domain
+      constexpr static inline std::uint64_t wyp[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+                                                       0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+      inline void wymum(std::uint64_t& a, std::uint64_t& b) {
+         const __uint128_t r = static_cast<__uint128_t>(a) * b;
+         a = static_cast<std::uint64_t>(r);
+         b = static_cast<std::uint64_t>(r >> 64);
+      }
+
+      inline std::uint64_t wymix(std::uint64_t a, std::uint64_t b) {
+         wymum(a, b);
+         return a ^ b;
+      }
+
+      inline std::uint64_t wyr8(const std::uint8_t* p) { std::uint64_t v; std::memcpy(&v, p, 8); return v; }
+      inline std::uint64_t wyr4(const std::uint8_t* p) { std::uint32_t v; std::memcpy(&v, p, 4); return v; }
+      inline std::uint64_t wyr3(const std::uint8_t* p, std::size_t k) {
+         return (std::uint64_t{p[0]} << 16) | (std::uint64_t{p[k >> 1]} << 8) | p[k - 1];
+      }
+
+      inline std::uint64_t wyhash(const void* key, std::size_t len, std::uint64_t seed) {
+         const auto* p = static_cast<const std::uint8_t*>(key);
+         seed ^= wymix(seed ^ wyp[0], wyp[1]);
+         std::uint64_t a, b;
+         if (len <= 16) {
+            if (len >= 4) {
+               a = (wyr4(p) << 32) | wyr4(p + ((len >> 3) << 2));
+               b = (wyr4(p + len - 4) << 32) | wyr4(p + len - 4 - ((len >> 3) << 2));
+            } else if (len > 0) {
+               a = wyr3(p, len);
+               b = 0;
+            } else {
+               a = b = 0;
+            }
+         } else {
+            std::size_t i = len;
+            if (i > 48) {
+               std::uint64_t see1 = seed, see2 = seed;
+               do {
+                  seed = wymix(wyr8(p) ^ wyp[1], wyr8(p + 8) ^ seed);
+                  see1 = wymix(wyr8(p + 16) ^ wyp[2], wyr8(p + 24) ^ see1);
+                  see2 = wymix(wyr8(p + 32) ^ wyp[3], wyr8(p + 40) ^ see2);
+                  p += 48;
+                  i -= 48;
+               } while (i > 48);
+               seed ^= see1 ^ see2;
+            }
+            while (i > 16) {
+               seed = wymix(wyr8(p) ^ wyp[1], wyr8(p + 8) ^ seed);
+               i -= 16;
+               p += 16;
+            }
+            a = wyr8(p + i - 16);
+            b = wyr8(p + i - 8);
+         }
+         a ^= wyp[1];
+         b ^= seed;
+         wymum(a, b);
+         return wymix(a ^ wyp[0] ^ len, b ^ wyp[1]);
+      }
+
+      inline std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t h) {
+         return wymix(seed ^ wyp[0], h ^ wyp[1]);
+      }
+
+      template <typename T>
+      inline std::uint64_t hash_value(const T& v, std::uint64_t seed);
+
+      template <typename C, std::size_t I>
+      inline std::uint64_t hash_field(const C& c, std::uint64_t seed) {
+         using meta_t = meta_hierarchy<C>;
+         if constexpr (meta_t::bitwise_run_heads[I] != 0) {
+            constexpr auto run = meta_t::bitwise_runs[meta_t::bitwise_run_heads[I]-1];
+            return wyhash(reinterpret_cast<const char*>(&c) + run.offset, run.size, seed);
+         } else if constexpr (is_bitwise<typename meta_t::template field_type<I>>()) {
+            return seed; // covered by the run that contains it
+         } else {
+            return hash_value(meta_t::template get<I>(c), seed);
+         }
+      }
+
+      template <typename C, std::size_t... Is>
+      inline std::uint64_t hash_fields(const C& c, std::uint64_t seed, std::index_sequence<Is...>) {
+         ((seed = hash_field<C, Is>(c, seed)), ...);
+         return seed;
+      }
+
+      template <typename T>
+      inline std::uint64_t hash_value(const T& v, std::uint64_t seed) {
+         if constexpr (is_reflected_v<T>) {
+            return hash_fields(v, seed, std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+         } else if constexpr (is_tuple_v<T>) {
+            meta_object<T>::for_each(v, [&](const auto& e) { seed = hash_value(e, seed); });
+            return seed;
+         } else if constexpr (std::is_floating_point_v<T>) {
+            const T n = v == T{0} ? T{0} : v;
+            return wyhash(&n, sizeof(n), seed);
+         } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            const std::string_view s = v;
+            return wyhash(s.data(), s.size(), seed);
+         } else if constexpr (is_bitwise<T>()) {
+            return wyhash(&v, sizeof(v), seed);
+         } else if constexpr (is_bool_vector<T>::value) {
+            return hash_combine(seed, std::hash<T>{}(v));
+         } else if constexpr (is_vector<T>::value || is_std_array<T>::value) {
+            using elem_t = typename T::value_type;
+            if constexpr (is_bitwise<elem_t>()) {
+               return wyhash(v.data(), v.size() * sizeof(elem_t), seed);
+            } else {
+               seed = hash_combine(seed, v.size());
+               for (const auto& e : v)
+                  seed = hash_value(e, seed);
+               return seed;
+            }
+         } else {
+            return hash_combine(seed, std::hash<T>{}(v));
+         }
+      }
+
+      template <typename T>
+      constexpr inline bool hashable();
+
+      template <typename Types, std::size_t... Is>
+      constexpr inline bool all_hashable(std::index_sequence<Is...>) {
+         return (hashable<std::tuple_element_t<Is, Types>>() && ...);
+      }
+
+      // whether hash_value() accepts T, mirroring its branches
+      template <typename T>
+      constexpr inline bool hashable() {
+         if constexpr (is_reflected_v<T>)
+            return all_hashable<typename meta_hierarchy<T>::types>(std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+         else if constexpr (is_tuple_v<T>)
+            return all_hashable<T>(std::make_index_sequence<std::tuple_size_v<T>>{});
+         else if constexpr (std::is_floating_point_v<T> || std::is_convertible_v<const T&, std::string_view> ||
+                            is_bitwise<T>() || is_bool_vector<T>::value)
+            return true;
+         else if constexpr (is_vector<T>::value || is_std_array<T>::value)
+            return hashable<typename T::value_type>();
+         else
+            // disabled std::hash specializations aren't default constructible
+            return std::is_default_constructible_v<std::hash<T>>;
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * Hash v with the given seed.
+    */
+   template <typename T>
+   inline std::uint64_t hash_value(const T& v, std::uint64_t seed = 0) {
+      return detail::hash_value(v, seed);
+   }
+
+   /**
+    * \struct hash
+    * Drop in replacement for std::hash, i.e. std::unordered_set<foo, meta::hash<foo>>.
+    */
+   template <typename T>
+   struct hash {
+      inline std::size_t operator()(const T& v) const { return static_cast<std::size_t>(hash_value(v)); }
+   };
+}} // ns bluegrass::meta
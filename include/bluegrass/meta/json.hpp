@@ -0,0 +1,655 @@
+#pragma once
+
+#include "lookup.hpp"
+#include "refl.hpp"
+#include "serialize.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file json.hpp
+ * Reflection driven JSON encoding and decoding.
+ *
+ * The key of every field, including the separator and the opening brace, is concatenated at
+ * compile time (`{"a":`, `,"b":`, ...) so only values are formatted at runtime.
+ * Output is appended to any buffer with push_back() and insert(end, first, last),
+ * i.e. std::string or std::vector<char>, reusing a cleared buffer doesn't allocate.
+ *
+ * Decoding is a single pass straight into the target object, keys are dispatched to fields
+ * through the perfect hash of lookup.hpp (fields of the class first, then of its bases), unknown
+ * keys are skipped without allocating, and std::string / std::vector fields reuse their capacity.
+ * Fields that are missing from the input are left untouched.
+ *
+ * Input is checked as RFC 8259 JSON, skipped values included: numbers follow the JSON grammar (no
+ * inf, nan, leading zeros or '+'), strings may not hold raw control characters, escapes and
+ * surrogate pairs must be well formed and nothing may follow the document. A null for a floating
+ * point field reads as NaN, the inverse of what the writer emits for non finite values.
+ */
+
+namespace bluegrass { namespace meta {
+   namespace detail {
+      template <std::size_t N>
+      constexpr inline bool json_names_unique(const std::array<std::string_view, N>& names) {
+         for (std::size_t i=0; i < N; i++)
+            for (std::size_t j=i+1; j < N; j++)
+               if (names[i] == names[j])
+                  return false;
+         return true;
+      }
+
+      /**
+       * The key fragments of the fields of C and its bases (meta_hierarchy<C>), fragment i is at
+       * chars[offsets[i], offsets[i+1]).
+       */
+      template <typename C>
+      struct json_keys {
+         constexpr static inline auto names = meta_hierarchy<C>::names;
+         static_assert(json_names_unique(names), "a field shadows a field of a base class, its JSON keys would collide");
+
+         constexpr static inline std::size_t size = [](){
+            std::size_t sz = 0;
+            for (const auto& n : names)
+               sz += n.size() + 4;
+            return sz;
+         }();
+
+         constexpr static inline auto offsets = [](){
+            std::array<std::size_t, names.size()+1> offs = {};
+            for (std::size_t i=0; i < names.size(); i++)
+               offs[i+1] = offs[i] + names[i].size() + 4;
+            return offs;
+         }();
+
+         constexpr static inline auto chars = [](){
+            std::array<char, size> cs = {};
+            std::size_t pos = 0;
+            for (std::size_t i=0; i < names.size(); i++) {
+               cs[pos++] = i == 0 ? '{' : ',';
+               cs[pos++] = '"';
+               for (char c : names[i])
+                  cs[pos++] = c;
+               cs[pos++] = '"';
+               cs[pos++] = ':';
+            }
+            return cs;
+         }();
+
+         template <std::size_t I>
+         constexpr static inline std::string_view fragment() {
+            return {chars.data() + offsets[I], offsets[I+1] - offsets[I]};
+         }
+      };
+
+      template <typename Buffer>
+      inline void json_append(Buffer& out, std::string_view s) {
+         out.insert(out.end(), s.begin(), s.end());
+      }
+
+      template <typename Buffer>
+      inline void json_write_string(Buffer& out, std::string_view s) {
+         constexpr char hex[] = "0123456789abcdef";
+         out.push_back('"');
+         std::size_t run = 0;
+         for (std::size_t i=0; i < s.size(); i++) {
+            const auto c = static_cast<unsigned char>(s[i]);
+            if (c >= 0x20 && c != '"' && c != '\\')
+               continue;
+            json_append(out, s.substr(run, i - run));
+            run = i + 1;
+            switch (c) {
+               case '"':  json_append(out, "\\\""); break;
+               case '\\': json_append(out, "\\\\"); break;
+               case '\n': json_append(out, "\\n"); break;
+               case '\r': json_append(out, "\\r"); break;
+               case '\t': json_append(out, "\\t"); break;
+               case '\b': json_append(out, "\\b"); break;
+               case '\f': json_append(out, "\\f"); break;
+               default: {
+                  const char esc[] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF]};
+                  json_append(out, {esc, sizeof(esc)});
+               }
+            }
+         }
+         json_append(out, s.substr(run));
+         out.push_back('"');
+      }
+
+      template <typename Buffer, typename T>
+      inline void json_write_number(Buffer& out, T v) {
+         if constexpr (std::is_floating_point_v<T>) {
+            if (!std::isfinite(v))
+               return json_append(out, "null");
+         }
+         char buf[64];
+         const auto res = std::to_chars(buf, buf + sizeof(buf), v);
+         json_append(out, {buf, static_cast<std::size_t>(res.ptr - buf)});
+      }
+
+      template <typename Buffer, typename T>
+      inline void json_write_value(Buffer& out, const T& v);
+
+      template <typename Buffer, typename C, std::size_t... Is>
+      inline void json_write_fields(Buffer& out, const C& v, std::index_sequence<Is...>) {
+         ((json_append(out, json_keys<C>::template fragment<Is>()),
+           json_write_value(out, meta_hierarchy<C>::template get<Is>(v))), ...);
+      }
+
+      template <typename Buffer, typename Range>
+      inline void json_write_array(Buffer& out, const Range& r) {
+         out.push_back('[');
+         bool first = true;
+         for (const auto& e : r) {
+            if (!first)
+               out.push_back(',');
+            first = false;
+            json_write_value(out, e);
+         }
+         out.push_back(']');
+      }
+
+      template <typename Buffer, typename T>
+      inline void json_write_value(Buffer& out, const T& v) {
+         if constexpr (is_reflected_v<T>) {
+            if constexpr (hierarchy_cardinality<T>() == 0) {
+               json_append(out, "{}");
+            } else {
+               json_write_fields(out, v, std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+               out.push_back('}');
+            }
+         } else if constexpr (is_tuple_v<T>) {
+            out.push_back('[');
+            std::size_t i = 0;
+            meta_object<T>::for_each(v, [&](const auto& e) {
+               if (i++ != 0)
+                  out.push_back(',');
+               json_write_value(out, e);
+            });
+            out.push_back(']');
+         } else if constexpr (std::is_same_v<T, bool>) {
+            json_append(out, v ? "true" : "false");
+         } else if constexpr (std::is_enum_v<T>) {
+            json_write_number(out, static_cast<std::underlying_type_t<T>>(v));
+         } else if constexpr (std::is_arithmetic_v<T>) {
+            json_write_number(out, v);
+         } else if constexpr (std::is_pointer_v<T> && std::is_convertible_v<const T&, std::string_view>) {
+            // a null C string has no characters to write
+            if (v == nullptr)
+               json_append(out, "null");
+            else
+               json_write_string(out, v);
+         } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            json_write_string(out, v);
+         } else if constexpr (is_vector<T>::value || is_std_array<T>::value) {
+            json_write_array(out, v);
+         } else {
+            static_assert(is_vector<T>::value, "type can't be written as json");
+         }
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * \struct json_error
+    * Thrown when decoding malformed JSON, or JSON that doesn't fit the target type.
+    */
+   struct json_error : std::runtime_error {
+      json_error(const char* what, std::size_t pos)
+         : std::runtime_error(std::string(what) + " at offset " + std::to_string(pos)), offset(pos) {}
+      std::size_t offset;
+   };
+
+   namespace detail {
+      class json_reader {
+         public:
+            constexpr explicit json_reader(std::string_view js) : _begin(js.data()), _p(js.data()), _end(js.data() + js.size()) {}
+
+            [[noreturn]] inline void fail(const char* what) const { throw json_error(what, _p - _begin); }
+
+            inline void skip_ws() {
+               while (_p != _end && (*_p == ' ' || *_p == '\n' || *_p == '\r' || *_p == '\t'))
+                  ++_p;
+            }
+
+            inline char peek() {
+               skip_ws();
+               if (_p == _end)
+                  fail("unexpected end of json");
+               return *_p;
+            }
+
+            inline void expect(char c) {
+               if (peek() != c)
+                  fail("unexpected character");
+               ++_p;
+            }
+
+            // consume c if it is the next token
+            inline bool consume(char c) {
+               if (peek() != c)
+                  return false;
+               ++_p;
+               return true;
+            }
+
+            inline void expect_literal(std::string_view lit) {
+               skip_ws();
+               if (static_cast<std::size_t>(_end - _p) < lit.size() || std::string_view(_p, lit.size()) != lit)
+                  fail("invalid literal");
+               _p += lit.size();
+            }
+
+            // the token is checked against the JSON number grammar first, as std::from_chars also takes
+            // inf, nan, leading zeros and '1.'
+            template <typename T>
+            inline void read_number(T& v) {
+               skip_ws();
+               const char* first = _p;
+               const char* last  = scan_number();
+               const auto res = std::from_chars(first, last, v);
+               if (res.ec != std::errc{})
+                  fail(res.ec == std::errc::result_out_of_range ? "number out of range" : "invalid number");
+               // i.e. a fraction or an exponent for an integer
+               if (res.ptr != last)
+                  fail("invalid number");
+               _p = last;
+            }
+
+            // append the decoded characters of a string to out
+            template <typename Out>
+            inline void read_string(Out& out) {
+               expect('"');
+               for (;;) {
+                  const char* run = _p;
+                  while (_p != _end && *_p != '"' && *_p != '\\') {
+                     if (static_cast<unsigned char>(*_p) < 0x20)
+                        fail("control character in string");
+                     ++_p;
+                  }
+                  out.append(run, _p - run);
+                  if (_p == _end)
+                     fail("unterminated string");
+                  if (*_p++ == '"')
+                     return;
+                  read_escape(out);
+               }
+            }
+
+            // the raw characters of a key, the common case of a key without escapes needs no copy
+            inline std::string_view read_key(std::array<char, 128>& scratch) {
+               expect('"');
+               const char* first = _p;
+               while (_p != _end && *_p != '"' && *_p != '\\' && static_cast<unsigned char>(*_p) >= 0x20)
+                  ++_p;
+               if (_p == _end)
+                  fail("unterminated string");
+               if (*_p == '"')
+                  return {first, static_cast<std::size_t>(_p++ - first)};
+               _p = first - 1;
+               fixed_string out{scratch};
+               read_string(out);
+               return out.view();
+            }
+
+            inline void skip_string() {
+               discard out;
+               read_string(out);
+            }
+
+            // skip a value, checking it as strictly as if it was decoded
+            inline void skip_value(std::size_t depth = 0) {
+               if (depth > max_depth)
+                  fail("json nested too deeply");
+               switch (peek()) {
+                  case '{':
+                     ++_p;
+                     if (consume('}'))
+                        return;
+                     do {
+                        if (peek() != '"')
+                           fail("expected a key");
+                        skip_string();
+                        expect(':');
+                        skip_value(depth + 1);
+                     } while (consume(','));
+                     expect('}');
+                     return;
+                  case '[':
+                     ++_p;
+                     if (consume(']'))
+                        return;
+                     do {
+                        skip_value(depth + 1);
+                     } while (consume(','));
+                     expect(']');
+                     return;
+                  case '"': skip_string(); return;
+                  case 't': expect_literal("true"); return;
+                  case 'f': expect_literal("false"); return;
+                  case 'n': expect_literal("null"); return;
+                  default:  _p = scan_number(); return;
+               }
+            }
+
+            inline bool at_end() {
+               skip_ws();
+               return _p == _end;
+            }
+
+         private:
+            // nesting of skipped values, deeper input is refused rather than overflowing the stack
+            constexpr static inline std::size_t max_depth = 512;
+
+            struct discard {
+               inline void append(const char*, std::size_t) {}
+               inline void push_back(char) {}
+            };
+
+            inline bool digit() const { return _p != _end && *_p >= '0' && *_p <= '9'; }
+
+            // end of the number starting at _p: -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+            inline const char* scan_number() {
+               const char* start = _p;
+               if (_p != _end && *_p == '-')
+                  ++_p;
+               if (!digit())
+                  fail(_p == start ? "unexpected character" : "invalid number");
+               if (*_p++ != '0')
+                  while (digit())
+                     ++_p;
+               if (_p != _end && *_p == '.') {
+                  ++_p;
+                  if (!digit())
+                     fail("invalid number");
+                  while (digit())
+                     ++_p;
+               }
+               if (_p != _end && (*_p == 'e' || *_p == 'E')) {
+                  ++_p;
+                  if (_p != _end && (*_p == '+' || *_p == '-'))
+                     ++_p;
+                  if (!digit())
+                     fail("invalid number");
+                  while (digit())
+                     ++_p;
+               }
+               const char* last = _p;
+               _p = start;
+               return last;
+            }
+
+            // stack buffer used to unescape keys, keys that don't fit can't match a field
+            struct fixed_string {
+               std::array<char, 128>& buf;
+               std::size_t size = 0;
+               inline void append(const char* s, std::size_t n) {
+                  for (std::size_t i=0; i < n; i++)
+                     push_back(s[i]);
+               }
+               inline void push_back(char c) {
+                  if (size < buf.size())
+                     buf[size] = c;
+                  size++;
+               }
+               inline std::string_view view() const {
+                  return size <= buf.size() ? std::string_view{buf.data(), size} : std::string_view{};
+               }
+            };
+
+            inline unsigned read_hex4() {
+               if (_end - _p < 4)
+                  fail("invalid unicode escape");
+               unsigned cp = 0;
+               for (int i=0; i < 4; i++) {
+                  const char c = *_p++;
+                  cp <<= 4;
+                  if (c >= '0' && c <= '9') cp |= c - '0';
+                  else if (c >= 'a' && c <= 'f') cp |= c - 'a' + 10;
+                  else if (c >= 'A' && c <= 'F') cp |= c - 'A' + 10;
+                  else fail("invalid unicode escape");
+               }
+               return cp;
+            }
+
+            template <typename Out>
+            inline void read_escape(Out& out) {
+               if (_p == _end)
+                  fail("unterminated string");
+               switch (*_p++) {
+                  case '"':  out.push_back('"'); break;
+                  case '\\': out.push_back('\\'); break;
+                  case '/':  out.push_back('/'); break;
+                  case 'b':  out.push_back('\b'); break;
+                  case 'f':  out.push_back('\f'); break;
+                  case 'n':  out.push_back('\n'); break;
+                  case 'r':  out.push_back('\r'); break;
+                  case 't':  out.push_back('\t'); break;
+                  case 'u': {
+                     unsigned cp = read_hex4();
+                     if (cp >= 0xD800 && cp < 0xDC00) {
+                        if (_end - _p < 2 || _p[0] != '\\' || _p[1] != 'u')
+                           fail("invalid surrogate pair");
+                        _p += 2;
+                        const unsigned lo = read_hex4();
+                        if (lo < 0xDC00 || lo >= 0xE000)
+                           fail("invalid surrogate pair");
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                     }
+                     if (cp < 0x80) {
+                        out.push_back(static_cast<char>(cp));
+                     } else if (cp < 0x800) {
+                        out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+                        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+                     } else if (cp < 0x10000) {
+                        out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+                        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+                        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+                     } else {
+                        out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+                        out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+                        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+                        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+                     }
+                     break;
+                  }
+                  default: fail("invalid escape");
+               }
+            }
+
+            const char* _begin;
+            const char* _p;
+            const char* _end;
+      };
+
+      template <typename T>
+      inline void json_read_value(json_reader& r, T& v);
+
+      template <typename C, std::size_t I>
+      inline void json_read_field(json_reader& r, C& c) {
+         json_read_value(r, meta_object<C>::template get<I>(c));
+      }
+
+      template <typename C, std::size_t... Is>
+      constexpr inline auto json_field_readers(std::index_sequence<Is...>) {
+         return std::array<void(*)(json_reader&, C&), sizeof...(Is)>{ &json_read_field<C, Is>... };
+      }
+
+      template <typename C>
+      inline bool json_read_member(json_reader& r, std::string_view key, C& c);
+
+      template <typename C, typename... Bs>
+      inline bool json_read_base_member([[maybe_unused]] json_reader& r, [[maybe_unused]] std::string_view key,
+                                        [[maybe_unused]] C& c, std::tuple<Bs...>*) {
+         return (json_read_member(r, key, static_cast<Bs&>(c)) || ...);
+      }
+
+      // read the value of key into the matching field of c or of its bases, false if there is none
+      template <typename C>
+      inline bool json_read_member(json_reader& r, std::string_view key, C& c) {
+         static_assert(json_names_unique(json_keys<C>::names), "a field shadows a field of a base class, its JSON key would be read twice");
+         constexpr static auto readers = json_field_readers<C>(std::make_index_sequence<meta_object<C>::cardinality>{});
+         const std::size_t idx = find_field<C>(key);
+         if (idx != field_npos) {
+            readers[idx](r, c);
+            return true;
+         }
+         return json_read_base_member(r, key, c, static_cast<typename meta_object<C>::bases*>(nullptr));
+      }
+
+      template <typename T, std::size_t... Is>
+      inline void json_read_tuple(json_reader& r, T& v, std::index_sequence<Is...>) {
+         r.expect('[');
+         ((Is != 0 ? r.expect(',') : void(), json_read_value(r, std::get<Is>(v))), ...);
+         r.expect(']');
+      }
+
+      template <typename T>
+      inline void json_read_value(json_reader& r, T& v) {
+         if constexpr (is_reflected_v<T>) {
+            std::array<char, 128> scratch;
+            r.expect('{');
+            if (r.consume('}'))
+               return;
+            do {
+               const std::string_view key = r.read_key(scratch);
+               r.expect(':');
+               if (!json_read_member(r, key, v))
+                  r.skip_value();
+            } while (r.consume(','));
+            r.expect('}');
+         } else if constexpr (is_tuple_v<T>) {
+            json_read_tuple(r, v, std::make_index_sequence<std::tuple_size_v<T>>{});
+         } else if constexpr (std::is_same_v<T, bool>) {
+            if (r.peek() == 't') {
+               r.expect_literal("true");
+               v = true;
+            } else {
+               r.expect_literal("false");
+               v = false;
+            }
+         } else if constexpr (std::is_enum_v<T>) {
+            std::underlying_type_t<T> u;
+            r.read_number(u);
+            v = static_cast<T>(u);
+         } else if constexpr (std::is_floating_point_v<T>) {
+            // null is what the writer emits for non finite values
+            if (r.peek() == 'n') {
+               r.expect_literal("null");
+               v = std::numeric_limits<T>::quiet_NaN();
+            } else {
+               r.read_number(v);
+            }
+         } else if constexpr (std::is_arithmetic_v<T>) {
+            r.read_number(v);
+         } else if constexpr (is_string<T>::value) {
+            v.clear();
+            r.read_string(v);
+         } else if constexpr (is_vector<T>::value) {
+            // decode into the existing elements first so their storage is reused
+            std::size_t n = 0;
+            r.expect('[');
+            if (!r.consume(']')) {
+               do {
+                  if (n == v.size())
+                     v.emplace_back();
+                  json_read_value(r, v[n++]);
+               } while (r.consume(','));
+               r.expect(']');
+            }
+            v.resize(n);
+         } else if constexpr (is_std_array<T>::value) {
+            r.expect('[');
+            for (std::size_t i=0; i < v.size(); i++) {
+               if (i != 0)
+                  r.expect(',');
+               json_read_value(r, v[i]);
+            }
+            r.expect(']');
+         } else {
+            static_assert(is_vector<T>::value, "type can't be read from json");
+         }
+      }
+
+      template <typename T>
+      constexpr inline bool json_writable();
+
+      template <typename T>
+      constexpr inline bool json_readable();
+
+      template <typename Types, std::size_t... Is>
+      constexpr inline bool json_all_writable(std::index_sequence<Is...>) {
+         return (json_writable<std::tuple_element_t<Is, Types>>() && ...);
+      }
+
+      template <typename Types, std::size_t... Is>
+      constexpr inline bool json_all_readable(std::index_sequence<Is...>) {
+         return (json_readable<std::tuple_element_t<Is, Types>>() && ...);
+      }
+
+      // whether json_write_value() accepts T, mirroring its branches
+      template <typename T>
+      constexpr inline bool json_writable() {
+         if constexpr (is_reflected_v<T>)
+            return json_all_writable<typename meta_hierarchy<T>::types>(std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+         else if constexpr (is_tuple_v<T>)
+            return json_all_writable<T>(std::make_index_sequence<std::tuple_size_v<T>>{});
+         else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_convertible_v<const T&, std::string_view>)
+            return true;
+         else if constexpr (is_vector<T>::value || is_std_array<T>::value)
+            return json_writable<typename T::value_type>();
+         else
+            return false;
+      }
+
+      // whether json_read_value() accepts T, mirroring its branches
+      template <typename T>
+      constexpr inline bool json_readable() {
+         if constexpr (is_reflected_v<T>)
+            return json_all_readable<typename meta_hierarchy<T>::types>(std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+         else if constexpr (is_tuple_v<T>)
+            return json_all_readable<T>(std::make_index_sequence<std::tuple_size_v<T>>{});
+         else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T> || is_string<T>::value)
+            return true;
+         else if constexpr (is_vector<T>::value || is_std_array<T>::value)
+            return json_readable<typename T::value_type>();
+         else
+            return false;
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * Decode the JSON document js into v.
+    */
+   template <typename T>
+   inline void from_json(std::string_view js, T& v) {
+      detail::json_reader r{js};
+      detail::json_read_value(r, v);
+      if (!r.at_end())
+         r.fail("trailing characters after json value");
+   }
+
+   /**
+    * Append the JSON encoding of v to out.
+    */
+   template <typename T, typename Buffer>
+   inline void to_json(const T& v, Buffer& out) {
+      detail::json_write_value(out, v);
+   }
+
+   template <typename T>
+   inline std::string to_json(const T& v) {
+      std::string out;
+      to_json(v, out);
+      return out;
+   }
+}} // ns bluegrass::meta
@@ -0,0 +1,425 @@
+#pragma once
+
+#include "refl.hpp"
+#include "soa.hpp"
+#include "utility.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * \file kernels.hpp
+ * Vectorized reductions and filters over the columns of a meta_soa_vector.
+ *
+ * The instruction set is picked at compile time (AVX2, then SSE2, then scalar) together with the
+ * field type reported by meta_object<T>::type<N>. Vectorized paths exist for float, double,
+ * int32_t and (AVX2 only) int64_t fields with std::plus, minimum, maximum and the where::
+ * predicates, everything else runs the scalar loop.
+ *
+ * Floating point sums are accumulated in lanes, so the result can differ from a sequential sum in
+ * the last bits. minimum and maximum skip NaN values on every path (the SIMD min/max instructions
+ * are given the accumulator as the operand they return on NaN), so a column of NaN reduces to the
+ * identity, +infinity or -infinity.
+ *
+ * Configure with -DENABLE_AVX2_TESTS=ON to also run the kernel tests built with -mavx2.
+ */
+
+namespace bluegrass { namespace meta {
+   struct minimum {
+      template <typename T>
+      constexpr const T& operator()(const T& a, const T& b) const { return b < a ? b : a; }
+   };
+
+   struct maximum {
+      template <typename T>
+      constexpr const T& operator()(const T& a, const T& b) const { return a < b ? b : a; }
+   };
+
+   enum class cmp_op { lt, le, gt, ge, eq, ne };
+
+   /**
+    * \struct column_predicate
+    * Comparison of a column value against a constant, these can be evaluated with SIMD compares.
+    */
+   template <cmp_op Op, typename V>
+   struct column_predicate {
+      V value;
+      template <typename T>
+      constexpr bool operator()(const T& v) const {
+         if constexpr (Op == cmp_op::lt) return v <  value;
+         else if constexpr (Op == cmp_op::le) return v <= value;
+         else if constexpr (Op == cmp_op::gt) return v >  value;
+         else if constexpr (Op == cmp_op::ge) return v >= value;
+         else if constexpr (Op == cmp_op::eq) return v == value;
+         else return v != value;
+      }
+   };
+
+   namespace where {
+      template <typename V> constexpr auto lt(V v) { return column_predicate<cmp_op::lt, V>{v}; }
+      template <typename V> constexpr auto le(V v) { return column_predicate<cmp_op::le, V>{v}; }
+      template <typename V> constexpr auto gt(V v) { return column_predicate<cmp_op::gt, V>{v}; }
+      template <typename V> constexpr auto ge(V v) { return column_predicate<cmp_op::ge, V>{v}; }
+      template <typename V> constexpr auto eq(V v) { return column_predicate<cmp_op::eq, V>{v}; }
+      template <typename V> constexpr auto ne(V v) { return column_predicate<cmp_op::ne, V>{v}; }
+   } // ns bluegrass::meta::where
+
+   /**
+    * \class selection
+    * Bitmap with one bit per row, produced by filter().
+    */
+   class selection {
+      public:
+         selection() = default;
+         explicit selection(std::size_t size) : _words((size + 63) / 64), _size(size) {}
+
+         inline bool test(std::size_t i) const { return (_words[i / 64] >> (i % 64)) & 1; }
+         inline void set(std::size_t i) { _words[i / 64] |= std::uint64_t{1} << (i % 64); }
+
+         inline std::size_t count() const {
+            std::size_t n = 0;
+            for (auto w : _words)
+               n += __builtin_popcountll(w);
+            return n;
+         }
+
+         inline std::size_t size() const { return _size; }
+         inline span<std::uint64_t> words() { return _words; }
+         inline span<const std::uint64_t> words() const { return _words; }
+
+      private:
+         std::vector<std::uint64_t> _words;
+         std::size_t                _size = 0;
+   };
+
+   namespace detail {
+      template <typename Op, typename V>
+      constexpr inline V reduce_identity() {
+         if constexpr (std::is_same_v<Op, minimum>)
+            return std::numeric_limits<V>::has_infinity ? std::numeric_limits<V>::infinity() : std::numeric_limits<V>::max();
+         else if constexpr (std::is_same_v<Op, maximum>)
+            return std::numeric_limits<V>::has_infinity ? -std::numeric_limits<V>::infinity() : std::numeric_limits<V>::lowest();
+         else
+            return V{};
+      }
+
+      template <typename Op>
+      constexpr static inline bool is_plus_v = std::is_same_v<Op, std::plus<>> || std::is_same_v<Op, std::plus<void>>;
+      template <typename Op, typename V>
+      constexpr static inline bool is_simd_op_v = is_plus_v<Op> || std::is_same_v<Op, std::plus<V>> ||
+                                                  std::is_same_v<Op, minimum> || std::is_same_v<Op, maximum>;
+
+      template <typename V, typename Op>
+      inline V scalar_reduce(span<const V> col, Op&& op) {
+         if constexpr (is_simd_op_v<std::decay_t<Op>, V>) {
+            V acc = reduce_identity<std::decay_t<Op>, V>();
+            for (const auto& v : col)
+               acc = op(acc, v);
+            return acc;
+         } else {
+            if (col.empty())
+               return V{};
+            V acc = col[0];
+            for (std::size_t i=1; i < col.size(); i++)
+               acc = op(acc, col[i]);
+            return acc;
+         }
+      }
+
+      template <typename V, typename Pred>
+      inline void scalar_filter(span<const V> col, Pred&& pred, selection& sel, std::size_t from = 0) {
+         for (std::size_t i=from; i < col.size(); i++)
+            if (pred(col[i]))
+               sel.set(i);
+      }
+
+      // per instruction set register wrappers, `supported` is false when only the scalar path exists
+      template <typename V, typename = void>
+      struct simd { constexpr static inline bool supported = false; };
+
+#if defined(__AVX2__)
+      template <>
+      struct simd<float> {
+         constexpr static inline bool supported = true;
+         constexpr static inline std::size_t width = 8;
+         using reg = __m256;
+         static inline reg load(const float* p) { return _mm256_loadu_ps(p); }
+         static inline reg set1(float v) { return _mm256_set1_ps(v); }
+         static inline void store(float* p, reg r) { _mm256_storeu_ps(p, r); }
+         static inline reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+         static inline reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+         static inline reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+         template <cmp_op Op>
+         static inline unsigned cmp(reg a, reg b) {
+            constexpr int imm = Op == cmp_op::lt ? _CMP_LT_OQ : Op == cmp_op::le ? _CMP_LE_OQ :
+                                Op == cmp_op::gt ? _CMP_GT_OQ : Op == cmp_op::ge ? _CMP_GE_OQ :
+                                Op == cmp_op::eq ? _CMP_EQ_OQ : _CMP_NEQ_UQ;
+            return _mm256_movemask_ps(_mm256_cmp_ps(a, b, imm));
+         }
+      };
+
+      template <>
+      struct simd<double> {
+         constexpr static inline bool supported = true;
+         constexpr static inline std::size_t width = 4;
+         using reg = __m256d;
+         static inline reg load(const double* p) { return _mm256_loadu_pd(p); }
+         static inline reg set1(double v) { return _mm256_set1_pd(v); }
+         static inline void store(double* p, reg r) { _mm256_storeu_pd(p, r); }
+         static inline reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+         static inline reg min(reg a, reg b) { return _mm256_min_pd(a, b); }
+         static inline reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+         template <cmp_op Op>
+         static inline unsigned cmp(reg a, reg b) {
+            constexpr int imm = Op == cmp_op::lt ? _CMP_LT_OQ : Op == cmp_op::le ? _CMP_LE_OQ :
+                                Op == cmp_op::gt ? _CMP_GT_OQ : Op == cmp_op::ge ? _CMP_GE_OQ :
+                                Op == cmp_op::eq ? _CMP_EQ_OQ : _CMP_NEQ_UQ;
+            return _mm256_movemask_pd(_mm256_cmp_pd(a, b, imm));
+         }
+      };
+
+      template <>
+      struct simd<std::int32_t> {
+         constexpr static inline bool supported = true;
+         constexpr static inline std::size_t width = 8;
+         using reg = __m256i;
+         static inline reg load(const std::int32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const reg*>(p)); }
+         static inline reg set1(std::int32_t v) { return _mm256_set1_epi32(v); }
+         static inline void store(std::int32_t* p, reg r) { _mm256_storeu_si256(reinterpret_cast<reg*>(p), r); }
+         static inline reg add(reg a, reg b) { return _mm256_add_epi32(a, b); }
+         static inline reg min(reg a, reg b) { return _mm256_min_epi32(a, b); }
+         static inline reg max(reg a, reg b) { return _mm256_max_epi32(a, b); }
+         template <cmp_op Op>
+         static inline unsigned cmp(reg a, reg b) {
+            reg r;
+            if constexpr (Op == cmp_op::lt) r = _mm256_cmpgt_epi32(b, a);
+            else if constexpr (Op == cmp_op::gt) r = _mm256_cmpgt_epi32(a, b);
+            else if constexpr (Op == cmp_op::eq) r = _mm256_cmpeq_epi32(a, b);
+            else if constexpr (Op == cmp_op::le) r = _mm256_cmpgt_epi32(a, b);
+            else if constexpr (Op == cmp_op::ge) r = _mm256_cmpgt_epi32(b, a);
+            else r = _mm256_cmpeq_epi32(a, b);
+            const unsigned bits = _mm256_movemask_ps(_mm256_castsi256_ps(r));
+            return (Op == cmp_op::le || Op == cmp_op::ge || Op == cmp_op::ne) ? ~bits & 0xFF : bits;
+         }
+      };
+
+      template <>
+      struct simd<std::int64_t> {
+         constexpr static inline bool supported = true;
+         constexpr static inline std::size_t width = 4;
+         using reg = __m256i;
+         static inline reg load(const std::int64_t* p) { return _mm256_loadu_si256(reinterpret_cast<const reg*>(p)); }
+         static inline reg set1(std::int64_t v) { return _mm256_set1_epi64x(v); }
+         static inline void store(std::int64_t* p, reg r) { _mm256_storeu_si256(reinterpret_cast<reg*>(p), r); }
+         static inline reg add(reg a, reg b) { return _mm256_add_epi64(a, b); }
+         static inline reg min(reg a, reg b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+         static inline reg max(reg a, reg b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+         template <cmp_op Op>
+         static inline unsigned cmp(reg a, reg b) {
+            reg r;
+            if constexpr (Op == cmp_op::lt) r = _mm256_cmpgt_epi64(b, a);
+            else if constexpr (Op == cmp_op::gt) r = _mm256_cmpgt_epi64(a, b);
+            else if constexpr (Op == cmp_op::eq) r = _mm256_cmpeq_epi64(a, b);
+            else if constexpr (Op == cmp_op::le) r = _mm256_cmpgt_epi64(a, b);
+            else if constexpr (Op == cmp_op::ge) r = _mm256_cmpgt_epi64(b, a);
+            else r = _mm256_cmpeq_epi64(a, b);
+            const unsigned bits = _mm256_movemask_pd(_mm256_castsi256_pd(r));
+            return (Op == cmp_op::le || Op == cmp_op::ge || Op == cmp_op::ne) ? ~bits & 0xF : bits;
+         }
+      };
+#elif defined(__SSE2__)
+      template <>
+      struct simd<float> {
+         constexpr static inline bool supported = true;
+         constexpr static inline std::size_t width = 4;
+         using reg = __m128;
+         static inline reg load(const float* p) { return _mm_loadu_ps(p); }
+         static inline reg set1(float v) { return _mm_set1_ps(v); }
+         static inline void store(float* p, reg r) { _mm_storeu_ps(p, r); }
+         static inline reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+         static inline reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+         static inline reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+         template <cmp_op Op>
+         static inline unsigned cmp(reg a, reg b) {
+            reg r;
+            if constexpr (Op == cmp_op::lt) r = _mm_cmplt_ps(a, b);
+            else if constexpr (Op == cmp_op::le) r = _mm_cmple_ps(a, b);
+            else if constexpr (Op == cmp_op::gt) r = _mm_cmpgt_ps(a, b);
+            else if constexpr (Op == cmp_op::ge) r = _mm_cmpge_ps(a, b);
+            else if constexpr (Op == cmp_op::eq) r = _mm_cmpeq_ps(a, b);
+            else r = _mm_cmpneq_ps(a, b);
+            return _mm_movemask_ps(r);
+         }
+      };
+
+      template <>
+      struct simd<double> {
+         constexpr static inline bool supported = true;
+         constexpr static inline std::size_t width = 2;
+         using reg = __m128d;
+         static inline reg load(const double* p) { return _mm_loadu_pd(p); }
+         static inline reg set1(double v) { return _mm_set1_pd(v); }
+         static inline void store(double* p, reg r) { _mm_storeu_pd(p, r); }
+         static inline reg add(reg a, reg b) { return _mm_add_pd(a, b); }
+         static inline reg min(reg a, reg b) { return _mm_min_pd(a, b); }
+         static inline reg max(reg a, reg b) { return _mm_max_pd(a, b); }
+         template <cmp_op Op>
+         static inline unsigned cmp(reg a, reg b) {
+            reg r;
+            if constexpr (Op == cmp_op::lt) r = _mm_cmplt_pd(a, b);
+            else if constexpr (Op == cmp_op::le) r = _mm_cmple_pd(a, b);
+            else if constexpr (Op == cmp_op::gt) r = _mm_cmpgt_pd(a, b);
+            else if constexpr (Op == cmp_op::ge) r = _mm_cmpge_pd(a, b);
+            else if constexpr (Op == cmp_op::eq) r = _mm_cmpeq_pd(a, b);
+            else r = _mm_cmpneq_pd(a, b);
+            return _mm_movemask_pd(r);
+         }
+      };
+
+      template <>
+      struct simd<std::int32_t> {
+         constexpr static inline bool supported = true;
+         constexpr static inline std::size_t width = 4;
+         using reg = __m128i;
+         static inline reg load(const std::int32_t* p) { return _mm_loadu_si128(reinterpret_cast<const reg*>(p)); }
+         static inline reg set1(std::int32_t v) { return _mm_set1_epi32(v); }
+         static inline void store(std::int32_t* p, reg r) { _mm_storeu_si128(reinterpret_cast<reg*>(p), r); }
+         static inline reg add(reg a, reg b) { return _mm_add_epi32(a, b); }
+         // no pminsd/pmaxsd before SSE4.1, select through the compare mask instead
+         static inline reg min(reg a, reg b) {
+            const reg m = _mm_cmpgt_epi32(a, b);
+            return _mm_or_si128(_mm_and_si128(m, b), _mm_andnot_si128(m, a));
+         }
+         static inline reg max(reg a, reg b) {
+            const reg m = _mm_cmpgt_epi32(a, b);
+            return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+         }
+         template <cmp_op Op>
+         static inline unsigned cmp(reg a, reg b) {
+            reg r;
+            if constexpr (Op == cmp_op::lt) r = _mm_cmplt_epi32(a, b);
+            else if constexpr (Op == cmp_op::gt) r = _mm_cmpgt_epi32(a, b);
+            else if constexpr (Op == cmp_op::eq) r = _mm_cmpeq_epi32(a, b);
+            else if constexpr (Op == cmp_op::le) r = _mm_cmpgt_epi32(a, b);
+            else if constexpr (Op == cmp_op::ge) r = _mm_cmplt_epi32(a, b);
+            else r = _mm_cmpeq_epi32(a, b);
+            const unsigned bits = _mm_movemask_ps(_mm_castsi128_ps(r));
+            return (Op == cmp_op::le || Op == cmp_op::ge || Op == cmp_op::ne) ? ~bits & 0xF : bits;
+         }
+      };
+#endif
+
+      template <typename V>
+      constexpr static inline bool has_simd_v = simd<V>::supported;
+
+      template <typename V, typename Op>
+      inline V simd_reduce(span<const V> col, Op&& op) {
+         using s = simd<V>;
+         using op_t = std::decay_t<Op>;
+         constexpr std::size_t w = s::width;
+         const std::size_t n = col.size() - col.size() % w;
+         auto acc = s::set1(reduce_identity<op_t, V>());
+         for (std::size_t i=0; i < n; i += w) {
+            if constexpr (std::is_same_v<op_t, minimum>)
+               acc = s::min(s::load(col.data() + i), acc);
+            else if constexpr (std::is_same_v<op_t, maximum>)
+               acc = s::max(s::load(col.data() + i), acc);
+            else
+               acc = s::add(acc, s::load(col.data() + i));
+         }
+         V lanes[w];
+         s::store(lanes, acc);
+         V result = lanes[0];
+         for (std::size_t i=1; i < w; i++)
+            result = op(result, lanes[i]);
+         for (std::size_t i=n; i < col.size(); i++)
+            result = op(result, col[i]);
+         return result;
+      }
+
+      // only predicates against a value of the column type are vectorized, so no conversion can
+      // change the result of the comparison
+      template <typename Pred, typename V>
+      struct is_simd_predicate : std::false_type {};
+      template <cmp_op Op, typename V>
+      struct is_simd_predicate<column_predicate<Op, V>, V> : std::true_type {};
+      template <typename Pred, typename V>
+      constexpr static inline bool is_simd_predicate_v = is_simd_predicate<Pred, V>::value;
+
+      template <typename V, cmp_op Op>
+      inline void simd_filter(span<const V> col, const column_predicate<Op, V>& pred, selection& sel) {
+         using s = simd<V>;
+         constexpr std::size_t w = s::width;
+         const std::size_t n = col.size() - col.size() % w;
+         const auto rhs = s::set1(pred.value);
+         auto words = sel.words();
+         for (std::size_t i=0; i < n; i += w) {
+            const std::uint64_t bits = s::template cmp<Op>(s::load(col.data() + i), rhs);
+            words[i / 64] |= bits << (i % 64);
+         }
+         scalar_filter(col, pred, sel, n);
+      }
+
+      template <typename T, auto Field>
+      constexpr inline std::size_t kernel_field_index() {
+         if constexpr (std::is_member_object_pointer_v<decltype(Field)>) {
+            static_assert(std::is_same_v<decltype(member_class(Field)), T>, "member does not belong to the row type");
+            return field_index_v<Field>;
+         } else
+            return Field;
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * Reduce a column with op, vectorized for std::plus<>, minimum and maximum.
+    * Vectorized (and minimum/maximum) reductions of an empty column return the identity of op,
+    * other reductions of an empty column return V{}.
+    */
+   template <typename V, typename Op>
+   inline V reduce(span<const V> col, Op&& op) {
+      if constexpr (detail::has_simd_v<V> && detail::is_simd_op_v<std::decay_t<Op>, V>)
+         return detail::simd_reduce(col, op);
+      else
+         return detail::scalar_reduce(col, op);
+   }
+
+   /**
+    * Reduce the column of the field Field (an index or a pointer to a reflected member).
+    * i.e. meta::reduce<&trade::price>(rows, std::plus<>{})
+    */
+   template <auto Field, typename T, typename Op>
+   inline auto reduce(const meta_soa_vector<T>& rows, Op&& op) {
+      return reduce(rows.template column<detail::kernel_field_index<T, Field>()>(), op);
+   }
+
+   /**
+    * Select every row of a column for which pred is true, vectorized for the where:: predicates
+    * whose value has the type of the column (i.e. where::gt(100.0) for a double column).
+    */
+   template <typename V, typename Pred>
+   inline selection filter(span<const V> col, Pred&& pred) {
+      selection sel{col.size()};
+      if constexpr (detail::has_simd_v<V> && detail::is_simd_predicate_v<std::decay_t<Pred>, V>)
+         detail::simd_filter(col, pred, sel);
+      else
+         detail::scalar_filter(col, pred, sel);
+      return sel;
+   }
+
+   /**
+    * Select every row for which pred(field) is true.
+    * i.e. meta::filter<&trade::qty>(rows, where::gt(100))
+    */
+   template <auto Field, typename T, typename Pred>
+   inline selection filter(const meta_soa_vector<T>& rows, Pred&& pred) {
+      return filter(rows.template column<detail::kernel_field_index<T, Field>()>(), pred);
+   }
+}} // ns bluegrass::meta
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "refl.hpp"
+#include "serialize.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file lazy.hpp
+ * Lazily decoded view of a reflected value in the serialize.hpp encoding.
+ *
+ * Construction walks the encoding once to record where every meta_hierarchy field starts, skipping
+ * length prefixed data without reading it. get<N>() decodes field N on first use and caches it, the
+ * other fields are never decoded.
+ */
+
+namespace bluegrass { namespace meta {
+   namespace detail {
+      template <typename T>
+      inline void skip_value(byte_reader& ds);
+
+      template <typename Types, std::size_t... Is>
+      inline void skip_values(byte_reader& ds, std::index_sequence<Is...>) {
+         (skip_value<std::tuple_element_t<Is, Types>>(ds), ...);
+      }
+
+      // advance ds past a value of T, the mirror of unpack() that decodes nothing but length prefixes
+      template <typename T>
+      inline void skip_value(byte_reader& ds) {
+         if constexpr (is_fixed_size_v<T>) {
+            ds.skip(max_serialized_size<T>());
+         } else if constexpr (is_reflected_v<T> || is_tuple_v<T>) {
+            using meta_t = std::conditional_t<is_tuple_v<T>, meta_object<T>, meta_hierarchy<T>>;
+            skip_values<typename meta_t::types>(ds, std::make_index_sequence<meta_t::cardinality>{});
+         } else if constexpr (is_string<T>::value || is_string_view<T>::value) {
+            ds.skip(unpack_length(ds) * sizeof(typename T::value_type));
+         } else if constexpr (is_vector<T>::value) {
+            const std::size_t len = unpack_length(ds);
+            if constexpr (is_fixed_size_v<typename T::value_type>) {
+               ds.skip(len * max_serialized_size<typename T::value_type>());
+            } else {
+               for (std::size_t i=0; i < len; i++)
+                  skip_value<typename T::value_type>(ds);
+            }
+         } else if constexpr (is_std_array<T>::value) {
+            for (std::size_t i=0; i < std::tuple_size_v<T>; i++)
+               skip_value<typename T::value_type>(ds);
+         } else {
+            static_assert(is_raw_v<T>, "type is not deserializable");
+         }
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * \class lazy_object
+    * A T decoded field by field from a buffer that must outlive it, fields are indexed as in
+    * meta_hierarchy<T>. Throws std::out_of_range from the constructor when buf is too short.
+    * Not thread safe, not even through const: get() and value() decode into a mutable cache, so a
+    * lazy_object shared between threads needs external synchronization (or value() called first).
+    */
+   template <typename T>
+   class lazy_object {
+      public:
+         using meta_t = meta_hierarchy<T>;
+         template <std::size_t N>
+         using type = typename meta_t::template type<N>;
+         constexpr static inline std::size_t cardinality = meta_t::cardinality;
+
+         static_assert(detail::is_reflected_v<T>, "lazy_object requires a reflected type");
+
+         explicit lazy_object(span<const std::byte> buf, std::pmr::memory_resource* resource = nullptr)
+            : _buf(buf), _resource(resource) {
+            byte_reader ds{buf};
+            index(ds, std::make_index_sequence<cardinality>{});
+            _offsets[cardinality] = ds.tellg();
+         }
+
+         /**
+          * Field N, decoded by the first call, which writes the cache without any synchronization.
+          */
+         template <std::size_t N>
+         inline const type<N>& get() const {
+            if (!_decoded.test(N)) {
+               byte_reader ds{raw<N>(), _resource};
+               unpack(ds, meta_t::template get<N>(_value));
+               _decoded.set(N);
+            }
+            return meta_t::template get<N>(_value);
+         }
+
+         /**
+          * The encoded bytes of field N, i.e. to forward it without decoding.
+          */
+         template <std::size_t N>
+         inline span<const std::byte> raw() const {
+            return _buf.subspan(_offsets[N], _offsets[N+1] - _offsets[N]);
+         }
+
+         template <std::size_t N>
+         inline bool decoded() const { return _decoded.test(N); }
+
+         /**
+          * The encoded bytes of the whole value.
+          */
+         inline span<const std::byte> bytes() const { return _buf.subspan(0, _offsets[cardinality]); }
+         inline std::size_t size() const { return _offsets[cardinality]; }
+
+         /**
+          * The value with every field decoded.
+          */
+         inline const T& value() const {
+            decode_all(std::make_index_sequence<cardinality>{});
+            return _value;
+         }
+
+      private:
+         template <std::size_t... Is>
+         inline void index(byte_reader& ds, std::index_sequence<Is...>) {
+            ((_offsets[Is] = ds.tellg(), detail::skip_value<type<Is>>(ds)), ...);
+         }
+
+         template <std::size_t... Is>
+         inline void decode_all(std::index_sequence<Is...>) const {
+            (get<Is>(), ...);
+         }
+
+         span<const std::byte>                   _buf;
+         std::pmr::memory_resource*              _resource = nullptr;
+         std::array<std::size_t, cardinality+1>  _offsets  = {};
+         mutable std::bitset<cardinality>        _decoded;
+         mutable T                               _value;
+   };
+}} // ns bluegrass::meta
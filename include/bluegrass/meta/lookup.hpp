@@ -0,0 +1,197 @@
+#pragma once
+
+#include "refl.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file lookup.hpp
+ * Runtime lookup of reflected fields by name through a perfect hash built at compile time.
+ */
+
+namespace bluegrass { namespace meta {
+   constexpr static inline std::size_t field_npos = std::numeric_limits<std::size_t>::max();
+
+   namespace detail {
+      constexpr inline std::uint64_t fnv1a(std::string_view s) {
+         std::uint64_t h = 0xcbf29ce484222325ull;
+         for (char c : s)
+            h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+         return h;
+      }
+
+      // finalizer from splitmix64, spreads the seeded key over the whole word
+      constexpr inline std::uint64_t mix64(std::uint64_t h) {
+         h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+         h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+         return h ^ (h >> 31);
+      }
+
+      constexpr inline std::size_t next_pow2(std::size_t n) {
+         std::size_t p = 1;
+         while (p < n)
+            p <<= 1;
+         return p;
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * \struct perfect_hash
+    * Hash and displace table mapping each of N compile time names to its index.
+    * Names are spread over buckets by their hash, each bucket stores the seed that places all of its
+    * names in free slots, so a lookup is one hash of the key, two table reads and one compare.
+    * The seed search gives up after max_seeds tries per bucket and clears complete, which callers
+    * building a table at compile time static_assert (see make_perfect_hash()).
+    */
+   template <std::size_t N>
+   struct perfect_hash {
+      constexpr static inline std::size_t buckets = N == 0 ? 1 : detail::next_pow2(N);
+      constexpr static inline std::size_t slots   = 2 * buckets;
+      constexpr static inline std::uint32_t max_seeds = 1u << 12;
+
+      std::array<std::string_view, N> names = {};
+      std::array<std::uint32_t, buckets> seeds = {};
+      std::array<std::size_t, slots> table = {};
+      // false if some names couldn't be placed, i.e. a name is listed twice
+      bool complete = true;
+
+      constexpr static inline std::size_t bucket_of(std::uint64_t h) { return h & (buckets - 1); }
+      constexpr static inline std::size_t slot_of(std::uint64_t h, std::uint32_t seed) {
+         return detail::mix64(h + seed) & (slots - 1);
+      }
+
+      constexpr explicit perfect_hash(const std::array<std::string_view, N>& ns) : names(ns) {
+         for (auto& t : table)
+            t = field_npos;
+
+         std::array<std::uint64_t, N> hashes = {};
+         std::array<std::size_t, buckets> sizes = {};
+         for (std::size_t i=0; i < N; i++) {
+            hashes[i] = detail::fnv1a(names[i]);
+            sizes[bucket_of(hashes[i])]++;
+         }
+
+         // place the largest buckets first while the table is still empty
+         std::array<bool, buckets> done = {};
+         for (std::size_t n=0; n < buckets; n++) {
+            std::size_t b = 0;
+            while (done[b])
+               b++;
+            for (std::size_t j=b+1; j < buckets; j++)
+               if (!done[j] && sizes[j] > sizes[b])
+                  b = j;
+            done[b] = true;
+            if (sizes[b] == 0)
+               continue;
+
+            // names of equal hash land in the same slot whatever the seed
+            for (std::size_t i=0; i < N; i++)
+               for (std::size_t j=i+1; j < N; j++)
+                  if (hashes[i] == hashes[j] && bucket_of(hashes[i]) == b)
+                     complete = false;
+
+            bool placed = false;
+            for (std::uint32_t seed=0; complete && !placed && seed < max_seeds; seed++) {
+               placed = true;
+               std::array<std::size_t, slots> taken = table;
+               for (std::size_t i=0; i < N && placed; i++) {
+                  if (bucket_of(hashes[i]) != b)
+                     continue;
+                  auto& slot = taken[slot_of(hashes[i], seed)];
+                  if (slot != field_npos)
+                     placed = false;
+                  else
+                     slot = i;
+               }
+               if (placed) {
+                  seeds[b] = seed;
+                  table = taken;
+               }
+            }
+            if (!placed) {
+               complete = false;
+               return;
+            }
+         }
+      }
+
+      /**
+       * Index of name, or field_npos if it isn't one of the names.
+       */
+      constexpr inline std::size_t find(std::string_view name) const {
+         if constexpr (N == 0) {
+            return field_npos;
+         } else {
+            const std::uint64_t h = detail::fnv1a(name);
+            const std::size_t idx = table[slot_of(h, seeds[bucket_of(h)])];
+            return idx != field_npos && names[idx] == name ? idx : field_npos;
+         }
+      }
+   };
+
+   template <std::size_t N>
+   perfect_hash(const std::array<std::string_view, N>&) -> perfect_hash<N>;
+
+   /**
+    * Perfect hash over the constant Names::value, failing to compile if it can't be built.
+    */
+   template <typename Names>
+   constexpr inline auto make_perfect_hash() {
+      constexpr auto h = perfect_hash{Names::value};
+      static_assert(h.complete, "perfect_hash: no seed separates the names, most likely a name is listed twice");
+      return h;
+   }
+
+   namespace detail {
+      template <typename C>
+      struct field_names { constexpr static inline auto value = meta_object<C>::names; };
+   } // ns bluegrass::meta::detail
+
+   /**
+    * Perfect hash over meta_object<C>::names.
+    */
+   template <typename C>
+   constexpr static inline auto field_hash_v = make_perfect_hash<detail::field_names<C>>();
+
+   /**
+    * Index of the field of C called name, or field_npos.
+    */
+   template <typename C>
+   constexpr inline std::size_t find_field(std::string_view name) {
+      return field_hash_v<C>.find(name);
+   }
+
+   namespace detail {
+      template <typename Obj, typename F, std::size_t I>
+      inline void visit_field_thunk(Obj& obj, F& f) {
+         f(meta_object<std::remove_const_t<Obj>>::template get<I>(obj));
+      }
+
+      template <typename Obj, typename F, std::size_t... Is>
+      constexpr inline auto visit_field_table(std::index_sequence<Is...>) {
+         return std::array<void(*)(Obj&, F&), sizeof...(Is)>{ &visit_field_thunk<Obj, F, Is>... };
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * Call f with a reference to the field of obj called name, dispatched through a jump table.
+    * @return false if obj has no field called name
+    */
+   template <typename T, typename F>
+   inline bool visit_field(T& obj, std::string_view name, F&& f) {
+      using class_t = std::remove_const_t<T>;
+      using f_t = std::remove_reference_t<F>;
+      constexpr static auto table = detail::visit_field_table<T, f_t>(std::make_index_sequence<meta_object<class_t>::cardinality>{});
+      const std::size_t idx = find_field<class_t>(name);
+      if (idx == field_npos)
+         return false;
+      table[idx](obj, f);
+      return true;
+   }
+}} // ns bluegrass::meta
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "lookup.hpp"
+#include "refl.hpp"
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file methods.hpp
+ * Reflection of member functions listed with META_REFL_METHODS.
+ *
+ * Methods are invoked by compile time index, or by runtime index or name through a constexpr
+ * table of thunks (one per method, for the return type and argument types of the call site), names
+ * are mapped to indices by the perfect hash of lookup.hpp. Overloaded methods can't be listed as
+ * their address is ambiguous.
+ */
+
+namespace bluegrass { namespace meta {
+   namespace detail {
+      template <typename C>
+      struct method_names { constexpr static inline auto value = C::_meta_refl_method_names(); };
+
+      template <typename C, typename R, typename Obj, std::size_t I, typename... Args>
+      inline R method_thunk(Obj& obj, Args&&... args) {
+         using method_t = typename meta_methods<C>::template method_type<I>;
+         if constexpr (std::is_invocable_r_v<R, method_t, Obj&, Args&&...>)
+            return static_cast<R>((obj.*std::get<I>(meta_methods<C>::method_ptrs))(std::forward<Args>(args)...));
+         else
+            throw std::invalid_argument("meta_methods: method not invocable with these arguments");
+      }
+
+      template <typename C, typename R, typename Obj, typename... Args, std::size_t... Is>
+      constexpr inline auto method_thunks(std::index_sequence<Is...>) {
+         return std::array<R(*)(Obj&, Args&&...), sizeof...(Is)>{ &method_thunk<C, R, Obj, Is, Args...>... };
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * \struct meta_methods
+    * The methods of C listed by META_REFL_METHODS, meta_object<C>::invoke() forwards here.
+    */
+   template <typename C>
+   struct meta_methods {
+      // tuple of pointers to member functions, i.e. std::tuple<void (C::*)(int), int (C::*)() const, ...>
+      constexpr static inline auto method_ptrs = C::template _meta_refl_method_ptrs<C>();
+      constexpr static inline auto names = C::_meta_refl_method_names();
+      constexpr static inline std::size_t cardinality = names.size();
+      constexpr static inline auto name_hash = make_perfect_hash<detail::method_names<C>>();
+
+      template <std::size_t I>
+      using method_type = std::tuple_element_t<I, std::decay_t<decltype(method_ptrs)>>;
+
+      /**
+       * Index of the method called name, or field_npos.
+       */
+      constexpr static inline std::size_t find(std::string_view name) { return name_hash.find(name); }
+
+      template <std::size_t I, typename Obj, typename... Args>
+      constexpr static inline decltype(auto) invoke(Obj& obj, Args&&... args) {
+         return (obj.*std::get<I>(method_ptrs))(std::forward<Args>(args)...);
+      }
+
+      /**
+       * Call method index on obj, through a jump table.
+       * Throws std::out_of_range for an index past the methods and std::invalid_argument when the
+       * method can't be called on obj with args or its result isn't convertible to R.
+       */
+      template <typename R, typename Obj, typename... Args>
+      static inline R invoke(Obj& obj, std::size_t index, Args&&... args) {
+         constexpr static auto table = detail::method_thunks<C, R, Obj, Args...>(std::make_index_sequence<cardinality>{});
+         if (index >= cardinality)
+            throw std::out_of_range("meta_methods: method index out of range");
+         return table[index](obj, std::forward<Args>(args)...);
+      }
+
+      /**
+       * Call the method called name on obj, throws std::out_of_range if there is none.
+       */
+      template <typename R, typename Obj, typename... Args>
+      static inline R invoke(Obj& obj, std::string_view name, Args&&... args) {
+         const std::size_t idx = find(name);
+         if (idx == field_npos)
+            throw std::out_of_range("meta_methods: no method with that name");
+         return invoke<R>(obj, idx, std::forward<Args>(args)...);
+      }
+   };
+
+   /**
+    * Index of the method of C called name, or field_npos.
+    */
+   template <typename C>
+   constexpr inline std::size_t find_method(std::string_view name) {
+      return meta_methods<C>::find(name);
+   }
+}} // ns bluegrass::meta
+
+/**
+ * @ingroup REFLECTION
+ * @brief Companion of META_REFL listing member functions, used by meta_methods and meta_object<C>::invoke().
+ *
+ * **Example**:
+ * @code
+ *  struct foo {
+ *    int a = 0;
+ *    int get() const { return a; }
+ *    void set(int v) { a = v; }
+ *    META_REFL(a);
+ *    META_REFL_METHODS(get, set);
+ * };
+ * @endcode
+ */
+#define META_REFL_METHODS(...)                                              \
+   public:                                                                  \
+   template <typename _meta_refl_cls>                                       \
+   constexpr inline static auto _meta_refl_method_ptrs() {                  \
+      return std::make_tuple(                                               \
+         META_FOREACH(META_MEMBER_PTR, _meta_refl_cls, ##__VA_ARGS__));     \
+   }                                                                        \
+   constexpr inline static auto _meta_refl_method_names() {                 \
+      return std::array<std::string_view, META_VA_ARGS_SIZE(__VA_ARGS__)> { \
+         META_FOREACH(META_PASS_STR, "ignored", ##__VA_ARGS__)              \
+      };                                                                    \
+   }
@@ -0,0 +1,207 @@
+#pragma once
+
+#include "refl.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * \file parallel.hpp
+ * Parallel field wise visitation of ranges of reflected objects.
+ *
+ * The range is cut into fixed size chunks which the workers claim from a shared atomic counter,
+ * so a worker that finishes early keeps taking chunks instead of idling behind a static split.
+ * The calling thread is one of the workers, the others come from a process wide pool whose threads
+ * are started on first use and then reused by every call. One call uses the pool at a time, a call
+ * made meanwhile (from another thread, or nested in a visitor) runs on its calling thread alone.
+ * Requires linking with the platform thread library.
+ */
+
+namespace bluegrass { namespace meta {
+   namespace detail {
+      /**
+       * \class worker_pool
+       * Threads kept waiting for jobs, joined when the process exits.
+       */
+      class worker_pool {
+         public:
+            static inline worker_pool& instance() {
+               static worker_pool pool;
+               return pool;
+            }
+
+            ~worker_pool() {
+               {
+                  std::lock_guard<std::mutex> lock(_mtx);
+                  _stop = true;
+               }
+               _wake.notify_all();
+               for (auto& t : _threads)
+                  t.join();
+            }
+
+            /**
+             * Call job on the calling thread and on up to helpers pool threads, returning once every
+             * call returned. job must not throw and must finish the work alone if no helper joins.
+             */
+            template <typename Job>
+            inline void run(std::size_t helpers, Job& job) {
+               // a visitor of this run calling back in must not touch _run_mtx, which its thread may own
+               if (_inside) {
+                  job();
+                  return;
+               }
+               std::unique_lock<std::mutex> busy(_run_mtx, std::try_to_lock);
+               if (!busy.owns_lock()) {
+                  job();
+                  return;
+               }
+               _inside = true;
+               struct leave { ~leave() { _inside = false; } } on_return;
+               grow(helpers);
+               {
+                  std::lock_guard<std::mutex> lock(_mtx);
+                  _fn      = [](void* j) { (*static_cast<Job*>(j))(); };
+                  _job     = &job;
+                  _wanted  = std::min(helpers, _threads.size());
+                  _running = _wanted;
+                  _generation++;
+               }
+               _wake.notify_all();
+               job();
+               std::unique_lock<std::mutex> lock(_mtx);
+               _done.wait(lock, [&]() { return _running == 0; });
+            }
+
+            /**
+             * Number of pool threads started so far.
+             */
+            inline std::size_t size() {
+               std::lock_guard<std::mutex> lock(_mtx);
+               return _threads.size();
+            }
+
+         private:
+            worker_pool() = default;
+
+            // running out of threads leaves the pool smaller
+            inline void grow(std::size_t n) {
+               std::lock_guard<std::mutex> lock(_mtx);
+               try {
+                  while (_threads.size() < n)
+                     _threads.emplace_back([this]() { loop(); });
+               } catch (const std::system_error&) {
+               }
+            }
+
+            inline void loop() {
+               _inside = true;
+               std::uint64_t seen = 0;
+               std::unique_lock<std::mutex> lock(_mtx);
+               for (;;) {
+                  _wake.wait(lock, [&]() { return _stop || (_generation != seen && _wanted != 0); });
+                  if (_stop)
+                     return;
+                  seen = _generation;
+                  _wanted--;
+                  lock.unlock();
+                  _fn(_job);
+                  lock.lock();
+                  if (--_running == 0)
+                     _done.notify_one();
+               }
+            }
+
+            // set on pool threads, and on the calling thread during run()
+            static inline thread_local bool _inside = false;
+
+            std::mutex               _run_mtx;
+            std::mutex               _mtx;
+            std::condition_variable  _wake;
+            std::condition_variable  _done;
+            std::vector<std::thread> _threads;
+            void                   (*_fn)(void*) = nullptr;
+            void*                    _job = nullptr;
+            std::size_t              _wanted = 0;
+            std::size_t              _running = 0;
+            std::uint64_t            _generation = 0;
+            bool                     _stop = false;
+      };
+
+      /**
+       * Call fn(first, last) over [0, n) in chunks of chunk, spread over workers threads.
+       * The first exception thrown by fn is rethrown once every worker has stopped.
+       */
+      template <typename Fn>
+      inline void parallel_chunks(std::size_t n, std::size_t chunk, std::size_t workers, Fn&& fn) {
+         std::atomic<std::size_t> next{0};
+         std::atomic<bool>        failed{false};
+         std::exception_ptr       error;
+         std::mutex               error_mtx;
+
+         auto work = [&]() {
+            for (std::size_t first = next.fetch_add(chunk); first < n && !failed; first = next.fetch_add(chunk)) {
+               try {
+                  fn(first, std::min(first + chunk, n));
+               } catch (...) {
+                  std::lock_guard<std::mutex> lock(error_mtx);
+                  if (!error)
+                     error = std::current_exception();
+                  failed = true;
+               }
+            }
+         };
+
+         worker_pool::instance().run(workers - 1, work);
+
+         if (error)
+            std::rethrow_exception(error);
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * Number of workers used when 0 is requested.
+    */
+   inline std::size_t default_workers() {
+      return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+   }
+
+   /**
+    * meta_object<T>::for_each_batch() split over workers threads.
+    * f is called concurrently from several threads, so it must not mutate shared state unguarded.
+    * @param r a random access range of reflected objects or tuples, i.e. std::vector<T> or span<T>
+    * @param workers number of threads including the caller, 0 for default_workers()
+    * @param chunk objects claimed at once, 0 to pick one that gives every worker several chunks
+    */
+   template <typename R, typename F>
+   inline void parallel_for_each_batch(R&& r, F&& f, std::size_t workers = 0, std::size_t chunk = 0) {
+      using object_t = std::remove_cv_t<std::remove_reference_t<decltype(*std::begin(r))>>;
+      using meta_t   = meta_object_t<object_t>;
+      const auto first = std::begin(r);
+      const std::size_t n = static_cast<std::size_t>(std::distance(first, std::end(r)));
+
+      workers = workers == 0 ? default_workers() : workers;
+      chunk   = chunk == 0 ? std::max<std::size_t>(1024, n / (workers * 8)) : chunk;
+      workers = std::min(workers, (n + chunk - 1) / chunk);
+
+      if (workers <= 1) {
+         meta_t::for_each_batch(r, f);
+         return;
+      }
+
+      detail::parallel_chunks(n, chunk, workers, [&](std::size_t b, std::size_t e) {
+         for (auto it = first + b, last = first + e; it != last; ++it)
+            meta_t::for_each(*it, f);
+      });
+   }
+}} // ns bluegrass::meta
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "compare.hpp"
+#include "refl.hpp"
+#include "serialize.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file patch.hpp
+ * Field level delta encoding between two instances of a reflected type.
+ *
+ * Patch encoding:
+ *    - a bitmask of ceil(F/8) bytes, F being the number of fields of the whole hierarchy, bit i
+ *      (byte i/8, bit i%8) is set when field i changed, fields in meta_hierarchy order
+ *    - the value of every changed field in the same order, encoded as by serialize.hpp
+ * Nested reflected fields are compared and sent as a whole.
+ */
+
+namespace bluegrass { namespace meta {
+   namespace detail {
+      template <typename C>
+      constexpr static inline std::size_t patch_mask_size = (hierarchy_cardinality<C>() + 7) / 8;
+
+      template <typename C>
+      using patch_mask = std::array<std::uint8_t, patch_mask_size<C>>;
+
+      constexpr inline bool patch_bit(const std::uint8_t* mask, std::size_t i) {
+         return (mask[i / 8] >> (i % 8)) & 1;
+      }
+
+      // Is are indices into meta_hierarchy<C>, which are also the bits of the mask
+      template <typename C, std::size_t... Is>
+      inline void diff_fields(const C& old, const C& now, std::uint8_t* mask, std::index_sequence<Is...>) {
+         using meta_t = meta_hierarchy<C>;
+         ((mask[Is / 8] |= static_cast<std::uint8_t>(
+               !equal_value(meta_t::template get<Is>(old), meta_t::template get<Is>(now)) << (Is % 8))), ...);
+      }
+
+      template <typename Stream, typename C, std::size_t... Is>
+      inline void pack_changed(Stream& ds, const C& now, const std::uint8_t* mask, std::index_sequence<Is...>) {
+         using meta_t = meta_hierarchy<C>;
+         ((patch_bit(mask, Is) ? pack(ds, meta_t::template get<Is>(now)) : void()), ...);
+      }
+
+      // what a changed field is decoded into before it is moved into the object, C arrays (which are
+      // always raw) become std::array with the same encoding
+      template <typename T>
+      struct patch_staged { using type = T; };
+
+      template <typename T, std::size_t N>
+      struct patch_staged<T[N]> { using type = std::array<typename patch_staged<T>::type, N>; };
+
+      template <typename T>
+      using patch_staged_t = typename patch_staged<T>::type;
+
+      template <typename T>
+      inline void patch_commit(T& field, patch_staged_t<T>& staged) {
+         if constexpr (std::is_array_v<T>)
+            std::memcpy(&field, &staged, sizeof(T));
+         else
+            field = std::move(staged);
+      }
+
+      // every changed field is decoded before obj is written, so a short or corrupt patch throws with obj untouched
+      template <typename Stream, typename C, std::size_t... Is>
+      inline void unpack_changed(Stream& ds, C& obj, const std::uint8_t* mask, std::index_sequence<Is...>) {
+         using meta_t = meta_hierarchy<C>;
+         // the declared field types, type<N> decays C arrays
+         std::tuple<std::optional<patch_staged_t<std::remove_reference_t<decltype(meta_t::template get<Is>(obj))>>>...> staged;
+         ((patch_bit(mask, Is) ? unpack(ds, std::get<Is>(staged).emplace()) : void()), ...);
+         ((std::get<Is>(staged) ? patch_commit(meta_t::template get<Is>(obj), *std::get<Is>(staged)) : void()), ...);
+      }
+
+      template <typename T>
+      inline patch_mask<T> diff_mask(const T& old, const T& now) {
+         patch_mask<T> mask = {};
+         diff_fields(old, now, mask.data(), std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+         return mask;
+      }
+
+      template <typename Stream, typename T>
+      inline void pack_patch(Stream& ds, const T& now, const patch_mask<T>& mask) {
+         ds.write(mask.data(), mask.size());
+         pack_changed(ds, now, mask.data(), std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * Write the patch turning old into now to buf.
+    * @return the number of bytes written
+    */
+   template <typename T>
+   inline std::size_t diff(const T& old, const T& now, span<std::byte> buf) {
+      static_assert(detail::is_reflected_v<T>, "diff requires a reflected type");
+      byte_writer ds{buf};
+      detail::pack_patch(ds, now, detail::diff_mask(old, now));
+      return ds.tellp();
+   }
+
+   /**
+    * The patch turning old into now.
+    */
+   template <typename T>
+   inline std::vector<std::byte> diff(const T& old, const T& now) {
+      static_assert(detail::is_reflected_v<T>, "diff requires a reflected type");
+      const auto mask = detail::diff_mask(old, now);
+      byte_counter bc;
+      detail::pack_patch(bc, now, mask);
+      std::vector<std::byte> buf(bc.tellp());
+      byte_writer ds{buf};
+      detail::pack_patch(ds, now, mask);
+      return buf;
+   }
+
+   /**
+    * Overwrite the fields of obj that are set in patch. The changed fields are decoded first, so when
+    * patch is short or corrupt this throws and obj keeps all of its values.
+    * Call it qualified, meta::apply(), as ADL on a std:: argument also finds std::apply.
+    * @return the number of bytes consumed
+    */
+   template <typename T>
+   inline std::size_t apply(T& obj, span<const std::byte> patch) {
+      static_assert(detail::is_reflected_v<T>, "apply requires a reflected type");
+      byte_reader ds{patch};
+      detail::patch_mask<T> mask;
+      ds.read(mask.data(), mask.size());
+      detail::unpack_changed(ds, obj, mask.data(), std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+      return ds.tellg();
+   }
+
+   /**
+    * Number of fields that changed according to patch.
+    */
+   template <typename T>
+   inline std::size_t changed_fields(span<const std::byte> patch) {
+      std::size_t n = 0;
+      const auto* mask = reinterpret_cast<const std::uint8_t*>(byte_reader{patch}.current(detail::patch_mask_size<T>));
+      for (std::size_t i=0; i < detail::hierarchy_cardinality<T>(); i++)
+         n += detail::patch_bit(mask, i);
+      return n;
+   }
+}} // ns bluegrass::meta
@@ -2,84 +2,290 @@
 
 #define META_EXPAND(X) X
 
-#define META_GET_NTH_ARG(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, NAME, ...) NAME
+#define META_GET_NTH_ARG(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78, _79, _80, _81, _82, _83, _84, _85, _86, _87, _88, _89, _90, _91, _92, _93, _94, _95, _96, _97, _98, _99, _100, _101, _102, _103, _104, _105, _106, _107, _108, _109, _110, _111, _112, _113, _114, _115, _116, _117, _118, _119, _120, _121, _122, _123, _124, _125, _126, _127, _128, _129, NAME, ...) NAME
 
 #define META_FE0(MAC, ...)
-#define META_FE1(MAC,  A, B) MAC(A, B)
-#define META_FE2(MAC,  A, B, ...) MAC(A, B) META_FE1(MAC,  A, ##__VA_ARGS__)
-#define META_FE3(MAC,  A, B, ...) MAC(A, B) META_FE2(MAC,  A, ##__VA_ARGS__)
-#define META_FE4(MAC,  A, B, ...) MAC(A, B) META_FE3(MAC,  A, ##__VA_ARGS__)
-#define META_FE5(MAC,  A, B, ...) MAC(A, B) META_FE4(MAC,  A, ##__VA_ARGS__)
-#define META_FE6(MAC,  A, B, ...) MAC(A, B) META_FE5(MAC,  A, ##__VA_ARGS__)
-#define META_FE7(MAC,  A, B, ...) MAC(A, B) META_FE6(MAC,  A, ##__VA_ARGS__)
-#define META_FE8(MAC,  A, B, ...) MAC(A, B) META_FE7(MAC,  A, ##__VA_ARGS__)
-#define META_FE9(MAC,  A, B, ...) MAC(A, B) META_FE8(MAC,  A, ##__VA_ARGS__)
-#define META_FE10(MAC, A, B, ...) MAC(A, B) META_FE9(MAC,  A, ##__VA_ARGS__)
-#define META_FE11(MAC, A, B, ...) MAC(A, B) META_FE10(MAC, A, ##__VA_ARGS__)
-#define META_FE12(MAC, A, B, ...) MAC(A, B) META_FE11(MAC, A, ##__VA_ARGS__)
-#define META_FE13(MAC, A, B, ...) MAC(A, B) META_FE12(MAC, A, ##__VA_ARGS__)
-#define META_FE14(MAC, A, B, ...) MAC(A, B) META_FE13(MAC, A, ##__VA_ARGS__)
-#define META_FE15(MAC, A, B, ...) MAC(A, B) META_FE14(MAC, A, ##__VA_ARGS__)
-#define META_FE16(MAC, A, B, ...) MAC(A, B) META_FE15(MAC, A, ##__VA_ARGS__)
-#define META_FE17(MAC, A, B, ...) MAC(A, B) META_FE16(MAC, A, ##__VA_ARGS__)
-#define META_FE18(MAC, A, B, ...) MAC(A, B) META_FE17(MAC, A, ##__VA_ARGS__)
-#define META_FE19(MAC, A, B, ...) MAC(A, B) META_FE18(MAC, A, ##__VA_ARGS__)
-#define META_FE20(MAC, A, B, ...) MAC(A, B) META_FE19(MAC, A, ##__VA_ARGS__)
-#define META_FE21(MAC, A, B, ...) MAC(A, B) META_FE20(MAC, A, ##__VA_ARGS__)
-#define META_FE22(MAC, A, B, ...) MAC(A, B) META_FE21(MAC, A, ##__VA_ARGS__)
-#define META_FE23(MAC, A, B, ...) MAC(A, B) META_FE22(MAC, A, ##__VA_ARGS__)
-#define META_FE24(MAC, A, B, ...) MAC(A, B) META_FE23(MAC, A, ##__VA_ARGS__)
-#define META_FE25(MAC, A, B, ...) MAC(A, B) META_FE24(MAC, A, ##__VA_ARGS__)
-#define META_FE26(MAC, A, B, ...) MAC(A, B) META_FE25(MAC, A, ##__VA_ARGS__)
-#define META_FE27(MAC, A, B, ...) MAC(A, B) META_FE26(MAC, A, ##__VA_ARGS__)
-#define META_FE28(MAC, A, B, ...) MAC(A, B) META_FE27(MAC, A, ##__VA_ARGS__)
-#define META_FE29(MAC, A, B, ...) MAC(A, B) META_FE28(MAC, A, ##__VA_ARGS__)
-#define META_FE30(MAC, A, B, ...) MAC(A, B) META_FE29(MAC, A, ##__VA_ARGS__)
-#define META_FE31(MAC, A, B, ...) MAC(A, B) META_FE30(MAC, A, ##__VA_ARGS__)
-#define META_FE32(MAC, A, B, ...) MAC(A, B) META_FE31(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA2(MAC,  A, B, ...) MAC(A, B), META_FE1(MAC,  A, ##__VA_ARGS__)
-#define META_FE_COMMA3(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA2(MAC,  A, ##__VA_ARGS__)
-#define META_FE_COMMA4(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA3(MAC,  A, ##__VA_ARGS__)
-#define META_FE_COMMA5(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA4(MAC,  A, ##__VA_ARGS__)
-#define META_FE_COMMA6(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA5(MAC,  A, ##__VA_ARGS__)
-#define META_FE_COMMA7(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA6(MAC,  A, ##__VA_ARGS__)
-#define META_FE_COMMA8(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA7(MAC,  A, ##__VA_ARGS__)
-#define META_FE_COMMA9(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA8(MAC,  A, ##__VA_ARGS__)
-#define META_FE_COMMA10(MAC, A, B, ...) MAC(A, B), META_FE_COMMA9(MAC,  A, ##__VA_ARGS__)
-#define META_FE_COMMA11(MAC, A, B, ...) MAC(A, B), META_FE_COMMA10(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA12(MAC, A, B, ...) MAC(A, B), META_FE_COMMA11(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA13(MAC, A, B, ...) MAC(A, B), META_FE_COMMA12(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA14(MAC, A, B, ...) MAC(A, B), META_FE_COMMA13(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA15(MAC, A, B, ...) MAC(A, B), META_FE_COMMA14(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA16(MAC, A, B, ...) MAC(A, B), META_FE_COMMA15(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA17(MAC, A, B, ...) MAC(A, B), META_FE_COMMA16(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA18(MAC, A, B, ...) MAC(A, B), META_FE_COMMA17(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA19(MAC, A, B, ...) MAC(A, B), META_FE_COMMA18(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA20(MAC, A, B, ...) MAC(A, B), META_FE_COMMA19(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA21(MAC, A, B, ...) MAC(A, B), META_FE_COMMA20(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA22(MAC, A, B, ...) MAC(A, B), META_FE_COMMA21(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA23(MAC, A, B, ...) MAC(A, B), META_FE_COMMA22(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA24(MAC, A, B, ...) MAC(A, B), META_FE_COMMA23(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA25(MAC, A, B, ...) MAC(A, B), META_FE_COMMA24(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA26(MAC, A, B, ...) MAC(A, B), META_FE_COMMA25(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA27(MAC, A, B, ...) MAC(A, B), META_FE_COMMA26(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA28(MAC, A, B, ...) MAC(A, B), META_FE_COMMA27(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA29(MAC, A, B, ...) MAC(A, B), META_FE_COMMA28(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA30(MAC, A, B, ...) MAC(A, B), META_FE_COMMA29(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA31(MAC, A, B, ...) MAC(A, B), META_FE_COMMA30(MAC, A, ##__VA_ARGS__)
-#define META_FE_COMMA32(MAC, A, B, ...) MAC(A, B), META_FE_COMMA31(MAC, A, ##__VA_ARGS__)
+#define META_FE1(MAC,   A, B) MAC(A, B)
+#define META_FE2(MAC,   A, B, ...) MAC(A, B) META_FE1(MAC,   A, ##__VA_ARGS__)
+#define META_FE3(MAC,   A, B, ...) MAC(A, B) META_FE2(MAC,   A, ##__VA_ARGS__)
+#define META_FE4(MAC,   A, B, ...) MAC(A, B) META_FE3(MAC,   A, ##__VA_ARGS__)
+#define META_FE5(MAC,   A, B, ...) MAC(A, B) META_FE4(MAC,   A, ##__VA_ARGS__)
+#define META_FE6(MAC,   A, B, ...) MAC(A, B) META_FE5(MAC,   A, ##__VA_ARGS__)
+#define META_FE7(MAC,   A, B, ...) MAC(A, B) META_FE6(MAC,   A, ##__VA_ARGS__)
+#define META_FE8(MAC,   A, B, ...) MAC(A, B) META_FE7(MAC,   A, ##__VA_ARGS__)
+#define META_FE9(MAC,   A, B, ...) MAC(A, B) META_FE8(MAC,   A, ##__VA_ARGS__)
+#define META_FE10(MAC,  A, B, ...) MAC(A, B) META_FE9(MAC,   A, ##__VA_ARGS__)
+#define META_FE11(MAC,  A, B, ...) MAC(A, B) META_FE10(MAC,  A, ##__VA_ARGS__)
+#define META_FE12(MAC,  A, B, ...) MAC(A, B) META_FE11(MAC,  A, ##__VA_ARGS__)
+#define META_FE13(MAC,  A, B, ...) MAC(A, B) META_FE12(MAC,  A, ##__VA_ARGS__)
+#define META_FE14(MAC,  A, B, ...) MAC(A, B) META_FE13(MAC,  A, ##__VA_ARGS__)
+#define META_FE15(MAC,  A, B, ...) MAC(A, B) META_FE14(MAC,  A, ##__VA_ARGS__)
+#define META_FE16(MAC,  A, B, ...) MAC(A, B) META_FE15(MAC,  A, ##__VA_ARGS__)
+#define META_FE17(MAC,  A, B, ...) MAC(A, B) META_FE16(MAC,  A, ##__VA_ARGS__)
+#define META_FE18(MAC,  A, B, ...) MAC(A, B) META_FE17(MAC,  A, ##__VA_ARGS__)
+#define META_FE19(MAC,  A, B, ...) MAC(A, B) META_FE18(MAC,  A, ##__VA_ARGS__)
+#define META_FE20(MAC,  A, B, ...) MAC(A, B) META_FE19(MAC,  A, ##__VA_ARGS__)
+#define META_FE21(MAC,  A, B, ...) MAC(A, B) META_FE20(MAC,  A, ##__VA_ARGS__)
+#define META_FE22(MAC,  A, B, ...) MAC(A, B) META_FE21(MAC,  A, ##__VA_ARGS__)
+#define META_FE23(MAC,  A, B, ...) MAC(A, B) META_FE22(MAC,  A, ##__VA_ARGS__)
+#define META_FE24(MAC,  A, B, ...) MAC(A, B) META_FE23(MAC,  A, ##__VA_ARGS__)
+#define META_FE25(MAC,  A, B, ...) MAC(A, B) META_FE24(MAC,  A, ##__VA_ARGS__)
+#define META_FE26(MAC,  A, B, ...) MAC(A, B) META_FE25(MAC,  A, ##__VA_ARGS__)
+#define META_FE27(MAC,  A, B, ...) MAC(A, B) META_FE26(MAC,  A, ##__VA_ARGS__)
+#define META_FE28(MAC,  A, B, ...) MAC(A, B) META_FE27(MAC,  A, ##__VA_ARGS__)
+#define META_FE29(MAC,  A, B, ...) MAC(A, B) META_FE28(MAC,  A, ##__VA_ARGS__)
+#define META_FE30(MAC,  A, B, ...) MAC(A, B) META_FE29(MAC,  A, ##__VA_ARGS__)
+#define META_FE31(MAC,  A, B, ...) MAC(A, B) META_FE30(MAC,  A, ##__VA_ARGS__)
+#define META_FE32(MAC,  A, B, ...) MAC(A, B) META_FE31(MAC,  A, ##__VA_ARGS__)
+#define META_FE33(MAC,  A, B, ...) MAC(A, B) META_FE32(MAC,  A, ##__VA_ARGS__)
+#define META_FE34(MAC,  A, B, ...) MAC(A, B) META_FE33(MAC,  A, ##__VA_ARGS__)
+#define META_FE35(MAC,  A, B, ...) MAC(A, B) META_FE34(MAC,  A, ##__VA_ARGS__)
+#define META_FE36(MAC,  A, B, ...) MAC(A, B) META_FE35(MAC,  A, ##__VA_ARGS__)
+#define META_FE37(MAC,  A, B, ...) MAC(A, B) META_FE36(MAC,  A, ##__VA_ARGS__)
+#define META_FE38(MAC,  A, B, ...) MAC(A, B) META_FE37(MAC,  A, ##__VA_ARGS__)
+#define META_FE39(MAC,  A, B, ...) MAC(A, B) META_FE38(MAC,  A, ##__VA_ARGS__)
+#define META_FE40(MAC,  A, B, ...) MAC(A, B) META_FE39(MAC,  A, ##__VA_ARGS__)
+#define META_FE41(MAC,  A, B, ...) MAC(A, B) META_FE40(MAC,  A, ##__VA_ARGS__)
+#define META_FE42(MAC,  A, B, ...) MAC(A, B) META_FE41(MAC,  A, ##__VA_ARGS__)
+#define META_FE43(MAC,  A, B, ...) MAC(A, B) META_FE42(MAC,  A, ##__VA_ARGS__)
+#define META_FE44(MAC,  A, B, ...) MAC(A, B) META_FE43(MAC,  A, ##__VA_ARGS__)
+#define META_FE45(MAC,  A, B, ...) MAC(A, B) META_FE44(MAC,  A, ##__VA_ARGS__)
+#define META_FE46(MAC,  A, B, ...) MAC(A, B) META_FE45(MAC,  A, ##__VA_ARGS__)
+#define META_FE47(MAC,  A, B, ...) MAC(A, B) META_FE46(MAC,  A, ##__VA_ARGS__)
+#define META_FE48(MAC,  A, B, ...) MAC(A, B) META_FE47(MAC,  A, ##__VA_ARGS__)
+#define META_FE49(MAC,  A, B, ...) MAC(A, B) META_FE48(MAC,  A, ##__VA_ARGS__)
+#define META_FE50(MAC,  A, B, ...) MAC(A, B) META_FE49(MAC,  A, ##__VA_ARGS__)
+#define META_FE51(MAC,  A, B, ...) MAC(A, B) META_FE50(MAC,  A, ##__VA_ARGS__)
+#define META_FE52(MAC,  A, B, ...) MAC(A, B) META_FE51(MAC,  A, ##__VA_ARGS__)
+#define META_FE53(MAC,  A, B, ...) MAC(A, B) META_FE52(MAC,  A, ##__VA_ARGS__)
+#define META_FE54(MAC,  A, B, ...) MAC(A, B) META_FE53(MAC,  A, ##__VA_ARGS__)
+#define META_FE55(MAC,  A, B, ...) MAC(A, B) META_FE54(MAC,  A, ##__VA_ARGS__)
+#define META_FE56(MAC,  A, B, ...) MAC(A, B) META_FE55(MAC,  A, ##__VA_ARGS__)
+#define META_FE57(MAC,  A, B, ...) MAC(A, B) META_FE56(MAC,  A, ##__VA_ARGS__)
+#define META_FE58(MAC,  A, B, ...) MAC(A, B) META_FE57(MAC,  A, ##__VA_ARGS__)
+#define META_FE59(MAC,  A, B, ...) MAC(A, B) META_FE58(MAC,  A, ##__VA_ARGS__)
+#define META_FE60(MAC,  A, B, ...) MAC(A, B) META_FE59(MAC,  A, ##__VA_ARGS__)
+#define META_FE61(MAC,  A, B, ...) MAC(A, B) META_FE60(MAC,  A, ##__VA_ARGS__)
+#define META_FE62(MAC,  A, B, ...) MAC(A, B) META_FE61(MAC,  A, ##__VA_ARGS__)
+#define META_FE63(MAC,  A, B, ...) MAC(A, B) META_FE62(MAC,  A, ##__VA_ARGS__)
+#define META_FE64(MAC,  A, B, ...) MAC(A, B) META_FE63(MAC,  A, ##__VA_ARGS__)
+#define META_FE65(MAC,  A, B, ...) MAC(A, B) META_FE64(MAC,  A, ##__VA_ARGS__)
+#define META_FE66(MAC,  A, B, ...) MAC(A, B) META_FE65(MAC,  A, ##__VA_ARGS__)
+#define META_FE67(MAC,  A, B, ...) MAC(A, B) META_FE66(MAC,  A, ##__VA_ARGS__)
+#define META_FE68(MAC,  A, B, ...) MAC(A, B) META_FE67(MAC,  A, ##__VA_ARGS__)
+#define META_FE69(MAC,  A, B, ...) MAC(A, B) META_FE68(MAC,  A, ##__VA_ARGS__)
+#define META_FE70(MAC,  A, B, ...) MAC(A, B) META_FE69(MAC,  A, ##__VA_ARGS__)
+#define META_FE71(MAC,  A, B, ...) MAC(A, B) META_FE70(MAC,  A, ##__VA_ARGS__)
+#define META_FE72(MAC,  A, B, ...) MAC(A, B) META_FE71(MAC,  A, ##__VA_ARGS__)
+#define META_FE73(MAC,  A, B, ...) MAC(A, B) META_FE72(MAC,  A, ##__VA_ARGS__)
+#define META_FE74(MAC,  A, B, ...) MAC(A, B) META_FE73(MAC,  A, ##__VA_ARGS__)
+#define META_FE75(MAC,  A, B, ...) MAC(A, B) META_FE74(MAC,  A, ##__VA_ARGS__)
+#define META_FE76(MAC,  A, B, ...) MAC(A, B) META_FE75(MAC,  A, ##__VA_ARGS__)
+#define META_FE77(MAC,  A, B, ...) MAC(A, B) META_FE76(MAC,  A, ##__VA_ARGS__)
+#define META_FE78(MAC,  A, B, ...) MAC(A, B) META_FE77(MAC,  A, ##__VA_ARGS__)
+#define META_FE79(MAC,  A, B, ...) MAC(A, B) META_FE78(MAC,  A, ##__VA_ARGS__)
+#define META_FE80(MAC,  A, B, ...) MAC(A, B) META_FE79(MAC,  A, ##__VA_ARGS__)
+#define META_FE81(MAC,  A, B, ...) MAC(A, B) META_FE80(MAC,  A, ##__VA_ARGS__)
+#define META_FE82(MAC,  A, B, ...) MAC(A, B) META_FE81(MAC,  A, ##__VA_ARGS__)
+#define META_FE83(MAC,  A, B, ...) MAC(A, B) META_FE82(MAC,  A, ##__VA_ARGS__)
+#define META_FE84(MAC,  A, B, ...) MAC(A, B) META_FE83(MAC,  A, ##__VA_ARGS__)
+#define META_FE85(MAC,  A, B, ...) MAC(A, B) META_FE84(MAC,  A, ##__VA_ARGS__)
+#define META_FE86(MAC,  A, B, ...) MAC(A, B) META_FE85(MAC,  A, ##__VA_ARGS__)
+#define META_FE87(MAC,  A, B, ...) MAC(A, B) META_FE86(MAC,  A, ##__VA_ARGS__)
+#define META_FE88(MAC,  A, B, ...) MAC(A, B) META_FE87(MAC,  A, ##__VA_ARGS__)
+#define META_FE89(MAC,  A, B, ...) MAC(A, B) META_FE88(MAC,  A, ##__VA_ARGS__)
+#define META_FE90(MAC,  A, B, ...) MAC(A, B) META_FE89(MAC,  A, ##__VA_ARGS__)
+#define META_FE91(MAC,  A, B, ...) MAC(A, B) META_FE90(MAC,  A, ##__VA_ARGS__)
+#define META_FE92(MAC,  A, B, ...) MAC(A, B) META_FE91(MAC,  A, ##__VA_ARGS__)
+#define META_FE93(MAC,  A, B, ...) MAC(A, B) META_FE92(MAC,  A, ##__VA_ARGS__)
+#define META_FE94(MAC,  A, B, ...) MAC(A, B) META_FE93(MAC,  A, ##__VA_ARGS__)
+#define META_FE95(MAC,  A, B, ...) MAC(A, B) META_FE94(MAC,  A, ##__VA_ARGS__)
+#define META_FE96(MAC,  A, B, ...) MAC(A, B) META_FE95(MAC,  A, ##__VA_ARGS__)
+#define META_FE97(MAC,  A, B, ...) MAC(A, B) META_FE96(MAC,  A, ##__VA_ARGS__)
+#define META_FE98(MAC,  A, B, ...) MAC(A, B) META_FE97(MAC,  A, ##__VA_ARGS__)
+#define META_FE99(MAC,  A, B, ...) MAC(A, B) META_FE98(MAC,  A, ##__VA_ARGS__)
+#define META_FE100(MAC, A, B, ...) MAC(A, B) META_FE99(MAC,  A, ##__VA_ARGS__)
+#define META_FE101(MAC, A, B, ...) MAC(A, B) META_FE100(MAC, A, ##__VA_ARGS__)
+#define META_FE102(MAC, A, B, ...) MAC(A, B) META_FE101(MAC, A, ##__VA_ARGS__)
+#define META_FE103(MAC, A, B, ...) MAC(A, B) META_FE102(MAC, A, ##__VA_ARGS__)
+#define META_FE104(MAC, A, B, ...) MAC(A, B) META_FE103(MAC, A, ##__VA_ARGS__)
+#define META_FE105(MAC, A, B, ...) MAC(A, B) META_FE104(MAC, A, ##__VA_ARGS__)
+#define META_FE106(MAC, A, B, ...) MAC(A, B) META_FE105(MAC, A, ##__VA_ARGS__)
+#define META_FE107(MAC, A, B, ...) MAC(A, B) META_FE106(MAC, A, ##__VA_ARGS__)
+#define META_FE108(MAC, A, B, ...) MAC(A, B) META_FE107(MAC, A, ##__VA_ARGS__)
+#define META_FE109(MAC, A, B, ...) MAC(A, B) META_FE108(MAC, A, ##__VA_ARGS__)
+#define META_FE110(MAC, A, B, ...) MAC(A, B) META_FE109(MAC, A, ##__VA_ARGS__)
+#define META_FE111(MAC, A, B, ...) MAC(A, B) META_FE110(MAC, A, ##__VA_ARGS__)
+#define META_FE112(MAC, A, B, ...) MAC(A, B) META_FE111(MAC, A, ##__VA_ARGS__)
+#define META_FE113(MAC, A, B, ...) MAC(A, B) META_FE112(MAC, A, ##__VA_ARGS__)
+#define META_FE114(MAC, A, B, ...) MAC(A, B) META_FE113(MAC, A, ##__VA_ARGS__)
+#define META_FE115(MAC, A, B, ...) MAC(A, B) META_FE114(MAC, A, ##__VA_ARGS__)
+#define META_FE116(MAC, A, B, ...) MAC(A, B) META_FE115(MAC, A, ##__VA_ARGS__)
+#define META_FE117(MAC, A, B, ...) MAC(A, B) META_FE116(MAC, A, ##__VA_ARGS__)
+#define META_FE118(MAC, A, B, ...) MAC(A, B) META_FE117(MAC, A, ##__VA_ARGS__)
+#define META_FE119(MAC, A, B, ...) MAC(A, B) META_FE118(MAC, A, ##__VA_ARGS__)
+#define META_FE120(MAC, A, B, ...) MAC(A, B) META_FE119(MAC, A, ##__VA_ARGS__)
+#define META_FE121(MAC, A, B, ...) MAC(A, B) META_FE120(MAC, A, ##__VA_ARGS__)
+#define META_FE122(MAC, A, B, ...) MAC(A, B) META_FE121(MAC, A, ##__VA_ARGS__)
+#define META_FE123(MAC, A, B, ...) MAC(A, B) META_FE122(MAC, A, ##__VA_ARGS__)
+#define META_FE124(MAC, A, B, ...) MAC(A, B) META_FE123(MAC, A, ##__VA_ARGS__)
+#define META_FE125(MAC, A, B, ...) MAC(A, B) META_FE124(MAC, A, ##__VA_ARGS__)
+#define META_FE126(MAC, A, B, ...) MAC(A, B) META_FE125(MAC, A, ##__VA_ARGS__)
+#define META_FE127(MAC, A, B, ...) MAC(A, B) META_FE126(MAC, A, ##__VA_ARGS__)
+#define META_FE128(MAC, A, B, ...) MAC(A, B) META_FE127(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA2(MAC,   A, B, ...) MAC(A, B), META_FE1(MAC,   A, ##__VA_ARGS__)
+#define META_FE_COMMA3(MAC,   A, B, ...) MAC(A, B), META_FE_COMMA2(MAC,   A, ##__VA_ARGS__)
+#define META_FE_COMMA4(MAC,   A, B, ...) MAC(A, B), META_FE_COMMA3(MAC,   A, ##__VA_ARGS__)
+#define META_FE_COMMA5(MAC,   A, B, ...) MAC(A, B), META_FE_COMMA4(MAC,   A, ##__VA_ARGS__)
+#define META_FE_COMMA6(MAC,   A, B, ...) MAC(A, B), META_FE_COMMA5(MAC,   A, ##__VA_ARGS__)
+#define META_FE_COMMA7(MAC,   A, B, ...) MAC(A, B), META_FE_COMMA6(MAC,   A, ##__VA_ARGS__)
+#define META_FE_COMMA8(MAC,   A, B, ...) MAC(A, B), META_FE_COMMA7(MAC,   A, ##__VA_ARGS__)
+#define META_FE_COMMA9(MAC,   A, B, ...) MAC(A, B), META_FE_COMMA8(MAC,   A, ##__VA_ARGS__)
+#define META_FE_COMMA10(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA9(MAC,   A, ##__VA_ARGS__)
+#define META_FE_COMMA11(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA10(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA12(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA11(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA13(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA12(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA14(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA13(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA15(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA14(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA16(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA15(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA17(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA16(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA18(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA17(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA19(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA18(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA20(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA19(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA21(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA20(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA22(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA21(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA23(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA22(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA24(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA23(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA25(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA24(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA26(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA25(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA27(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA26(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA28(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA27(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA29(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA28(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA30(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA29(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA31(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA30(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA32(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA31(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA33(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA32(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA34(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA33(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA35(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA34(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA36(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA35(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA37(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA36(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA38(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA37(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA39(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA38(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA40(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA39(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA41(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA40(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA42(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA41(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA43(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA42(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA44(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA43(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA45(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA44(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA46(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA45(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA47(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA46(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA48(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA47(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA49(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA48(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA50(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA49(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA51(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA50(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA52(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA51(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA53(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA52(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA54(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA53(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA55(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA54(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA56(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA55(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA57(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA56(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA58(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA57(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA59(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA58(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA60(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA59(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA61(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA60(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA62(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA61(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA63(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA62(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA64(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA63(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA65(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA64(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA66(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA65(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA67(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA66(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA68(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA67(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA69(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA68(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA70(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA69(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA71(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA70(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA72(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA71(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA73(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA72(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA74(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA73(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA75(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA74(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA76(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA75(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA77(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA76(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA78(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA77(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA79(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA78(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA80(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA79(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA81(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA80(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA82(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA81(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA83(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA82(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA84(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA83(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA85(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA84(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA86(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA85(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA87(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA86(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA88(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA87(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA89(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA88(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA90(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA89(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA91(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA90(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA92(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA91(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA93(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA92(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA94(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA93(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA95(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA94(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA96(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA95(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA97(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA96(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA98(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA97(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA99(MAC,  A, B, ...) MAC(A, B), META_FE_COMMA98(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA100(MAC, A, B, ...) MAC(A, B), META_FE_COMMA99(MAC,  A, ##__VA_ARGS__)
+#define META_FE_COMMA101(MAC, A, B, ...) MAC(A, B), META_FE_COMMA100(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA102(MAC, A, B, ...) MAC(A, B), META_FE_COMMA101(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA103(MAC, A, B, ...) MAC(A, B), META_FE_COMMA102(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA104(MAC, A, B, ...) MAC(A, B), META_FE_COMMA103(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA105(MAC, A, B, ...) MAC(A, B), META_FE_COMMA104(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA106(MAC, A, B, ...) MAC(A, B), META_FE_COMMA105(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA107(MAC, A, B, ...) MAC(A, B), META_FE_COMMA106(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA108(MAC, A, B, ...) MAC(A, B), META_FE_COMMA107(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA109(MAC, A, B, ...) MAC(A, B), META_FE_COMMA108(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA110(MAC, A, B, ...) MAC(A, B), META_FE_COMMA109(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA111(MAC, A, B, ...) MAC(A, B), META_FE_COMMA110(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA112(MAC, A, B, ...) MAC(A, B), META_FE_COMMA111(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA113(MAC, A, B, ...) MAC(A, B), META_FE_COMMA112(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA114(MAC, A, B, ...) MAC(A, B), META_FE_COMMA113(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA115(MAC, A, B, ...) MAC(A, B), META_FE_COMMA114(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA116(MAC, A, B, ...) MAC(A, B), META_FE_COMMA115(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA117(MAC, A, B, ...) MAC(A, B), META_FE_COMMA116(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA118(MAC, A, B, ...) MAC(A, B), META_FE_COMMA117(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA119(MAC, A, B, ...) MAC(A, B), META_FE_COMMA118(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA120(MAC, A, B, ...) MAC(A, B), META_FE_COMMA119(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA121(MAC, A, B, ...) MAC(A, B), META_FE_COMMA120(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA122(MAC, A, B, ...) MAC(A, B), META_FE_COMMA121(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA123(MAC, A, B, ...) MAC(A, B), META_FE_COMMA122(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA124(MAC, A, B, ...) MAC(A, B), META_FE_COMMA123(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA125(MAC, A, B, ...) MAC(A, B), META_FE_COMMA124(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA126(MAC, A, B, ...) MAC(A, B), META_FE_COMMA125(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA127(MAC, A, B, ...) MAC(A, B), META_FE_COMMA126(MAC, A, ##__VA_ARGS__)
+#define META_FE_COMMA128(MAC, A, B, ...) MAC(A, B), META_FE_COMMA127(MAC, A, ##__VA_ARGS__)
 
-#define META_FOREACH_NO_COMMA(MAC, D, ...)    \
+#define META_FOREACH_NO_COMMA(MAC, D, ...)\
    META_GET_NTH_ARG("ignored", ##__VA_ARGS__, \
-      META_FE32,META_FE31,META_FE30,META_FE29,META_FE28,META_FE27,META_FE26,META_FE25,META_FE24,META_FE23,META_FE22,META_FE21,META_FE20,META_FE19,META_FE18,META_FE17,META_FE16,META_FE15,META_FE14,META_FE13,META_FE12,META_FE11,META_FE10,META_FE9,META_FE8,META_FE7,META_FE6,META_FE5,META_FE4,META_FE3,META_FE2,META_FE1,META_FE0)(MAC, D, ##__VA_ARGS__)
+      META_FE128,META_FE127,META_FE126,META_FE125,META_FE124,META_FE123,META_FE122,META_FE121,META_FE120,META_FE119,META_FE118,META_FE117,META_FE116,META_FE115,META_FE114,META_FE113, \
+      META_FE112,META_FE111,META_FE110,META_FE109,META_FE108,META_FE107,META_FE106,META_FE105,META_FE104,META_FE103,META_FE102,META_FE101,META_FE100,META_FE99,META_FE98,META_FE97, \
+      META_FE96,META_FE95,META_FE94,META_FE93,META_FE92,META_FE91,META_FE90,META_FE89,META_FE88,META_FE87,META_FE86,META_FE85,META_FE84,META_FE83,META_FE82,META_FE81, \
+      META_FE80,META_FE79,META_FE78,META_FE77,META_FE76,META_FE75,META_FE74,META_FE73,META_FE72,META_FE71,META_FE70,META_FE69,META_FE68,META_FE67,META_FE66,META_FE65, \
+      META_FE64,META_FE63,META_FE62,META_FE61,META_FE60,META_FE59,META_FE58,META_FE57,META_FE56,META_FE55,META_FE54,META_FE53,META_FE52,META_FE51,META_FE50,META_FE49, \
+      META_FE48,META_FE47,META_FE46,META_FE45,META_FE44,META_FE43,META_FE42,META_FE41,META_FE40,META_FE39,META_FE38,META_FE37,META_FE36,META_FE35,META_FE34,META_FE33, \
+      META_FE32,META_FE31,META_FE30,META_FE29,META_FE28,META_FE27,META_FE26,META_FE25,META_FE24,META_FE23,META_FE22,META_FE21,META_FE20,META_FE19,META_FE18,META_FE17, \
+      META_FE16,META_FE15,META_FE14,META_FE13,META_FE12,META_FE11,META_FE10,META_FE9,META_FE8,META_FE7,META_FE6,META_FE5,META_FE4,META_FE3,META_FE2,META_FE1, \
+      META_FE0)(MAC, D, ##__VA_ARGS__)
 
-#define META_FOREACH(MAC, D, ...)             \
+#define META_FOREACH(MAC, D, ...)         \
    META_GET_NTH_ARG("ignored", ##__VA_ARGS__, \
-      META_FE_COMMA32,META_FE_COMMA31,META_FE_COMMA30,META_FE_COMMA29,META_FE_COMMA28,META_FE_COMMA27,META_FE_COMMA26,META_FE_COMMA25,META_FE_COMMA24,META_FE_COMMA23,META_FE_COMMA22,META_FE_COMMA21,META_FE_COMMA20,META_FE_COMMA19,META_FE_COMMA18,META_FE_COMMA17,META_FE_COMMA16,META_FE_COMMA15,META_FE_COMMA14,META_FE_COMMA13,META_FE_COMMA12,META_FE_COMMA11,META_FE_COMMA10,META_FE_COMMA9,META_FE_COMMA8,META_FE_COMMA7,META_FE_COMMA6,META_FE_COMMA5,META_FE_COMMA4,META_FE_COMMA3,META_FE_COMMA2,META_FE1,META_FE0)(MAC, D, ##__VA_ARGS__)
+      META_FE_COMMA128,META_FE_COMMA127,META_FE_COMMA126,META_FE_COMMA125,META_FE_COMMA124,META_FE_COMMA123,META_FE_COMMA122,META_FE_COMMA121,META_FE_COMMA120,META_FE_COMMA119,META_FE_COMMA118,META_FE_COMMA117,META_FE_COMMA116,META_FE_COMMA115,META_FE_COMMA114,META_FE_COMMA113, \
+      META_FE_COMMA112,META_FE_COMMA111,META_FE_COMMA110,META_FE_COMMA109,META_FE_COMMA108,META_FE_COMMA107,META_FE_COMMA106,META_FE_COMMA105,META_FE_COMMA104,META_FE_COMMA103,META_FE_COMMA102,META_FE_COMMA101,META_FE_COMMA100,META_FE_COMMA99,META_FE_COMMA98,META_FE_COMMA97, \
+      META_FE_COMMA96,META_FE_COMMA95,META_FE_COMMA94,META_FE_COMMA93,META_FE_COMMA92,META_FE_COMMA91,META_FE_COMMA90,META_FE_COMMA89,META_FE_COMMA88,META_FE_COMMA87,META_FE_COMMA86,META_FE_COMMA85,META_FE_COMMA84,META_FE_COMMA83,META_FE_COMMA82,META_FE_COMMA81, \
+      META_FE_COMMA80,META_FE_COMMA79,META_FE_COMMA78,META_FE_COMMA77,META_FE_COMMA76,META_FE_COMMA75,META_FE_COMMA74,META_FE_COMMA73,META_FE_COMMA72,META_FE_COMMA71,META_FE_COMMA70,META_FE_COMMA69,META_FE_COMMA68,META_FE_COMMA67,META_FE_COMMA66,META_FE_COMMA65, \
+      META_FE_COMMA64,META_FE_COMMA63,META_FE_COMMA62,META_FE_COMMA61,META_FE_COMMA60,META_FE_COMMA59,META_FE_COMMA58,META_FE_COMMA57,META_FE_COMMA56,META_FE_COMMA55,META_FE_COMMA54,META_FE_COMMA53,META_FE_COMMA52,META_FE_COMMA51,META_FE_COMMA50,META_FE_COMMA49, \
+      META_FE_COMMA48,META_FE_COMMA47,META_FE_COMMA46,META_FE_COMMA45,META_FE_COMMA44,META_FE_COMMA43,META_FE_COMMA42,META_FE_COMMA41,META_FE_COMMA40,META_FE_COMMA39,META_FE_COMMA38,META_FE_COMMA37,META_FE_COMMA36,META_FE_COMMA35,META_FE_COMMA34,META_FE_COMMA33, \
+      META_FE_COMMA32,META_FE_COMMA31,META_FE_COMMA30,META_FE_COMMA29,META_FE_COMMA28,META_FE_COMMA27,META_FE_COMMA26,META_FE_COMMA25,META_FE_COMMA24,META_FE_COMMA23,META_FE_COMMA22,META_FE_COMMA21,META_FE_COMMA20,META_FE_COMMA19,META_FE_COMMA18,META_FE_COMMA17, \
+      META_FE_COMMA16,META_FE_COMMA15,META_FE_COMMA14,META_FE_COMMA13,META_FE_COMMA12,META_FE_COMMA11,META_FE_COMMA10,META_FE_COMMA9,META_FE_COMMA8,META_FE_COMMA7,META_FE_COMMA6,META_FE_COMMA5,META_FE_COMMA4,META_FE_COMMA3,META_FE_COMMA2,META_FE1, \
+      META_FE0)(MAC, D, ##__VA_ARGS__)
 
 #define META_VA_ARGS_SIZE(...)                        \
    bluegrass::meta::detail::va_args_count_helper(     \
          META_FOREACH(                                \
             META_PASS_STR, "ignored", ##__VA_ARGS__))
-
-
@@ -4,7 +4,9 @@
 #include "utility.hpp"
 #include "preprocessor.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <string_view>
 #include <tuple>
 #include <utility>
@@ -29,17 +31,150 @@ namespace bluegrass { namespace meta {
       return full_name.substr(start+4, end - start - 4);
    }
 
+   namespace detail {
+      template <std::size_t N>
+      struct fixed_name {
+         std::array<char, N> chars = {};
+         std::size_t         size  = 0;
+
+         constexpr inline void append(std::string_view s) {
+            for (char c : s)
+               chars[size++] = c;
+         }
+         constexpr inline std::string_view view() const { return {chars.data(), size}; }
+      };
+
+      constexpr inline bool is_ident_char(char c) {
+         return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+      }
+
+      // tok at s[i] as a whole token, the caller checks the character before i
+      constexpr inline bool token_at(std::string_view s, std::size_t i, std::string_view tok) {
+         return s.substr(i, tok.size()) == tok && (i + tok.size() == s.size() || !is_ident_char(s[i + tok.size()]));
+      }
+
+      // GCC spellings of the builtin integer types and the (shorter) Clang spellings they become
+      constexpr static inline std::string_view builtin_spellings[][2] = {
+         {"long long unsigned int", "unsigned long long"}, {"long unsigned int", "unsigned long"},
+         {"short unsigned int", "unsigned short"}, {"long long int", "long long"}, {"long int", "long"},
+         {"short int", "short"}
+      };
+
+      // spelling fixes that only depend on the text at s[i]
+      template <std::size_t N>
+      constexpr inline void normalize_spelling(std::string_view s, fixed_name<N>& out) {
+         for (std::size_t i=0; i < s.size();) {
+            const char prev = out.size == 0 ? '\0' : out.chars[out.size-1];
+            bool replaced = false;
+            if (!is_ident_char(prev)) {
+               for (const auto& sp : builtin_spellings) {
+                  if (token_at(s, i, sp[0])) {
+                     out.append(sp[1]);
+                     i += sp[0].size();
+                     replaced = true;
+                     break;
+                  }
+               }
+            }
+            if (replaced)
+               continue;
+            // inline namespaces of libc++ and of the libstdc++ C++11 ABI
+            if (prev == ':' && s.substr(i, 5) == "__1::") {
+               i += 5;
+            } else if (prev == ':' && s.substr(i, 9) == "__cxx11::") {
+               i += 9;
+            } else if (s.substr(i, 21) == "(anonymous namespace)") {
+               out.append("{anonymous}");
+               i += 21;
+            } else if (s[i] == ' ' && i+1 < s.size() && (s[i+1] == '>' || s[i+1] == '*' || s[i+1] == '&' || s[i+1] == '[')) {
+               i++;
+            } else {
+               out.chars[out.size++] = s[i++];
+            }
+         }
+      }
+
+      // drop the defaulted char_traits and allocator template arguments, which only GCC prints
+      template <std::size_t N>
+      constexpr inline void drop_default_args(std::string_view s, fixed_name<N>& out) {
+         for (std::size_t i=0; i < s.size();) {
+            const std::string_view traits = ", std::char_traits<";
+            const std::string_view alloc  = ", std::allocator<";
+            std::size_t skip = s.substr(i, traits.size()) == traits ? traits.size()
+                             : s.substr(i, alloc.size()) == alloc ? alloc.size() : 0;
+            if (skip == 0) {
+               out.chars[out.size++] = s[i++];
+               continue;
+            }
+            std::size_t depth = 1;
+            for (i += skip; i < s.size() && depth != 0; i++)
+               depth += s[i] == '<' ? 1 : s[i] == '>' ? -1 : 0;
+         }
+      }
+
+      template <std::size_t N>
+      constexpr inline fixed_name<N> normalize_type_name(std::string_view name) {
+         fixed_name<N> spelled;
+         normalize_spelling(name, spelled);
+         fixed_name<N> out;
+         drop_default_args(spelled.view(), out);
+         return out;
+      }
+
+      template <typename T>
+      constexpr static inline auto normalized_name_v = normalize_type_name<type_name<T>().size()>(type_name<T>());
+   } // ns bluegrass::meta::detail
+
+   /**
+    * type_name<T>() spelled the same by GCC and Clang: no inline std namespaces (std::__1::,
+    * std::__cxx11::), no defaulted char_traits/allocator arguments, no space in "> >", "T *" or
+    * "T [N]", Clang spellings of the builtin integer types and {anonymous} for anonymous namespaces.
+    */
+   template <typename T>
+   constexpr inline std::string_view normalized_type_name() {
+      return detail::normalized_name_v<T>.view();
+   }
+
    // tag used to define an invalid fields for field_types
    struct invalid_t {};
 
+   /**
+    * \struct base_types_t
+    * Declares several bases of a reflected class, i.e. using super_t = base_types_t<A, B>;
+    * their fields come before the fields of the class, A's first.
+    */
    template <typename... Bases>
    struct base_types_t {
+      using types = std::tuple<Bases...>;
       template <std::size_t N>
       using at_type = std::tuple_element_t<N, std::tuple<Bases...>>;
       template <typename T>
       using get_type = std::decay_t<decltype(std::get<T>(std::declval<std::tuple<Bases...>>()))>;
    };
 
+   /**
+    * \struct field_layout
+    * Compile time description of where a reflected field lives inside of its class.
+    */
+   struct field_layout {
+      std::size_t offset;
+      std::size_t size;
+      std::size_t alignment;
+      bool trivially_copyable;
+   };
+
+   /**
+    * \struct field_run
+    * A run of adjacent trivially copyable fields with no padding between them,
+    * the whole run can be copied with a single memcpy.
+    */
+   struct field_run {
+      std::size_t first;  // index of the first field of the run
+      std::size_t count;  // number of fields in the run
+      std::size_t offset; // byte offset of the first field
+      std::size_t size;   // number of bytes spanned by the run
+   };
+
    namespace detail {
       META_HAS_MEMBER_GENERATOR(valid, _meta_refl_valid);
       template <typename C>
@@ -62,6 +197,19 @@ namespace bluegrass { namespace meta {
          using type = typename T::super_t;
       };
 
+      // the direct bases of C as a tuple: none, its super_t, or every class of a base_types_t super_t
+      template <typename C, typename S>
+      struct direct_bases { using type = std::tuple<S>; };
+
+      template <typename C>
+      struct direct_bases<C, C> { using type = std::tuple<>; };
+
+      template <typename C, typename... Bs>
+      struct direct_bases<C, base_types_t<Bs...>> { using type = std::tuple<Bs...>; };
+
+      template <typename C>
+      using direct_bases_t = typename direct_bases<C, typename get_super_t<C>::type>::type;
+
       template <typename T>
       constexpr inline std::size_t cardinality() {
          if constexpr (std::is_same_v<T, invalid_t>)
@@ -104,6 +252,99 @@ namespace bluegrass { namespace meta {
 
       template <typename T>
       struct wrapper { using type = T; };
+
+      template <typename Ptr>
+      struct member_type;
+      template <typename F, typename K>
+      struct member_type<F K::*> { using type = F; };
+
+      // the declared types of a tuple of member pointers, C arrays included (unlike flatten_parameters_t)
+      template <typename Ptrs>
+      struct member_types;
+      template <typename... Ps>
+      struct member_types<std::tuple<Ps...>> { using type = std::tuple<typename member_type<Ps>::type...>; };
+      template <typename Ptrs>
+      using member_types_t = typename member_types<std::decay_t<Ptrs>>::type;
+
+      template <typename Types, std::size_t N, std::size_t... Is>
+      constexpr inline auto make_layout(const std::array<std::size_t, N>& offsets, std::index_sequence<Is...>) {
+         return std::array<field_layout, N>{
+            field_layout{ offsets[Is],
+                          sizeof(std::tuple_element_t<Is, Types>),
+                          alignof(std::tuple_element_t<Is, Types>),
+                          std::is_trivially_copyable_v<std::tuple_element_t<Is, Types>> }...
+         };
+      }
+
+      template <std::size_t N>
+      constexpr inline std::size_t count_runs(const std::array<field_layout, N>& layout) {
+         std::size_t runs = 0;
+         for (std::size_t i=0; i < N; i++) {
+            if (!layout[i].trivially_copyable)
+               continue;
+            if (i == 0 || !layout[i-1].trivially_copyable ||
+                layout[i-1].offset + layout[i-1].size != layout[i].offset)
+               runs++;
+         }
+         return runs;
+      }
+
+      template <std::size_t R, std::size_t N>
+      constexpr inline auto make_runs(const std::array<field_layout, N>& layout) {
+         std::array<field_run, R> runs = {};
+         std::size_t r = 0;
+         for (std::size_t i=0; i < N; i++) {
+            if (!layout[i].trivially_copyable)
+               continue;
+            if (r > 0 && runs[r-1].first + runs[r-1].count == i &&
+                runs[r-1].offset + runs[r-1].size == layout[i].offset) {
+               runs[r-1].count++;
+               runs[r-1].size += layout[i].size;
+            } else {
+               runs[r++] = field_run{i, 1, layout[i].offset, layout[i].size};
+            }
+         }
+         return runs;
+      }
+
+      template <typename T>
+      constexpr inline bool is_bitwise();
+
+      // layout where only fields whose value is fully described by their bytes may form runs
+      template <typename Types, std::size_t N, std::size_t... Is>
+      constexpr inline auto bitwise_layout(std::array<field_layout, N> layout, std::index_sequence<Is...>) {
+         ((layout[Is].trivially_copyable = is_bitwise<std::tuple_element_t<Is, Types>>()), ...);
+         return layout;
+      }
+
+      // for each field: 0 if it doesn't start a run, otherwise 1 + the index of the run it starts
+      template <std::size_t N, std::size_t R>
+      constexpr inline auto run_heads(const std::array<field_run, R>& runs) {
+         std::array<std::size_t, N> heads = {};
+         for (std::size_t r=0; r < R; r++)
+            heads[runs[r].first] = r + 1;
+         return heads;
+      }
+
+      template <std::size_t N>
+      constexpr inline std::size_t field_bytes(const std::array<field_layout, N>& layout) {
+         std::size_t bytes = 0;
+         for (std::size_t i=0; i < N; i++)
+            bytes += layout[i].size;
+         return bytes;
+      }
+
+      template <typename Bases>
+      struct bases_field_bytes;
+
+      template <typename C>
+      constexpr inline std::size_t padding_bytes();
+
+      template <typename T, typename = void>
+      struct is_complete : std::false_type {};
+
+      template <typename T>
+      struct is_complete<T, std::void_t<decltype(sizeof(T))>> : std::true_type {};
    } // ns bluegrass::meta::detail
 
    /**
@@ -114,26 +355,34 @@ namespace bluegrass { namespace meta {
    struct meta_object_mixin {
       using derived_t = C;
       constexpr static inline std::string_view this_name = type_name<typename derived_t::this_t>();
+      // this_name spelled the same on every compiler and standard library, see normalized_type_name()
+      constexpr static inline std::string_view normalized_name = normalized_type_name<typename derived_t::this_t>();
 
-      template <std::size_t N, typename T, typename F>
-      constexpr inline static auto for_each_impl( T&& t, F&& f ) {
-         if constexpr (N+1 == derived_t::cardinality)
-            return f(derived_t::template get<N>(std::forward<T>(t)));
-         else {
-            f(derived_t::template get<N>(std::forward<T>(t)));
-            return for_each_impl<N+1>(std::forward<T>(t), std::forward<F>(f));
-         }
+      // one flat fold over the fields rather than one instantiation per field
+      template <typename T, typename F, std::size_t... Is>
+      constexpr inline static void for_each_impl( T& t, F& f, std::index_sequence<Is...> ) {
+         ((void)f(derived_t::template get<Is>(t)), ...);
       }
 
       template <typename T, typename F>
       constexpr inline static void for_each( T&& t, F&& f ) {
-         if constexpr (derived_t::cardinality == 0)
-            return;
-         else
-            return for_each_impl<0>(t, f);
+         for_each_impl(t, f, std::make_index_sequence<derived_t::cardinality>{});
+      }
+
+      // for_each() over every object of a range
+      template <typename R, typename F>
+      constexpr inline static void for_each_batch( R&& r, F&& f ) {
+         for (auto&& t : r)
+            for_each(t, f);
       }
    };
 
+   template <typename C>
+   struct meta_hierarchy;
+
+   template <typename C>
+   struct meta_methods;
+
    /**
     * \struct meta_object
     * A type used for reflection.
@@ -146,29 +395,76 @@ namespace bluegrass { namespace meta {
       using mixin_t::for_each;
       using this_t = C;
       using super_t = typename detail::get_super_t<C>::type;
+      // the direct bases as a tuple, empty if C has no super_t
+      using bases = detail::direct_bases_t<C>;
       using types = flatten_parameters_t<&C::_meta_refl_fields>;
       template <std::size_t N>
       using type = std::tuple_element_t<N, types>;
       constexpr static inline std::size_t cardinality = detail::cardinality<types>();
       constexpr static auto names = C::_meta_refl_field_names();
+      // tuple of pointers to data members, i.e. std::tuple<int C::*, float C::*, ...>
+      constexpr static auto field_ptrs = C::template _meta_refl_field_mptrs<C>();
+      // declared types of the fields, type<N> decays C arrays to pointers while field_type<N> keeps them
+      using field_types = detail::member_types_t<decltype(field_ptrs)>;
+      template <std::size_t N>
+      using field_type = std::tuple_element_t<N, field_types>;
+
+      // per field offset, size, alignment and trivially copyable flag
+      constexpr static auto layout = detail::make_layout<field_types>(C::template _meta_refl_field_offsets<C>(),
+                                                                      std::make_index_sequence<cardinality>{});
+      // runs of adjacent and padding free trivially copyable fields
+      constexpr static auto trivial_runs = detail::make_runs<detail::count_runs(layout)>(layout);
+      // runs of adjacent and padding free fields compared by their bytes (integral, enum and such aggregates),
+      // i.e. equal values have equal bytes so the run can be hashed or compared as raw memory
+      constexpr static auto bitwise_runs = [](){
+         constexpr auto bl = detail::bitwise_layout<field_types>(layout, std::make_index_sequence<cardinality>{});
+         return detail::make_runs<detail::count_runs(bl)>(bl);
+      }();
+      constexpr static auto bitwise_run_heads = detail::run_heads<cardinality>(bitwise_runs);
+
+      // bytes covered by the reflected fields of this class and all of its bases
+      constexpr static std::size_t field_bytes = detail::field_bytes(layout) + detail::bases_field_bytes<bases>::value;
+      // padding the reflected fields of the hierarchy need: between neighbouring fields and after the last one,
+      // exact when every member is reflected. Padding inside of a reflected field is in its own meta_object.
+      constexpr static std::size_t padding = detail::padding_bytes<C>();
+      // bytes of the object that are not covered by a reflected field, padding as well as unreflected members,
+      // unreflected bases and such
+      constexpr static std::size_t unreflected_bytes = sizeof(C) - field_bytes;
 
       template <std::size_t N>
       constexpr static inline auto& get(C& c) {
-         using type = std::tuple_element_t<N, types>;
-         return *reinterpret_cast<type*>(c.template _meta_refl_field_ptr<N>());
+         return c.*std::get<N>(field_ptrs);
       }
 
       template <std::size_t N>
       constexpr static inline const auto& get(const C& c) {
-         using type = std::tuple_element_t<N, types>;
-         return *reinterpret_cast<type*>(c.template _meta_refl_field_ptr<N>());
+         return c.*std::get<N>(field_ptrs);
+      }
+
+      // call method I of those listed by META_REFL_METHODS, see meta_methods (methods.hpp, which must be included)
+      template <std::size_t I, typename Obj, typename... Args>
+      constexpr inline static decltype(auto) invoke( Obj& obj, Args&&... args ) {
+         static_assert(detail::is_complete<meta_methods<C>>::value, "meta_object::invoke() requires bluegrass/meta/methods.hpp");
+         return meta_methods<C>::template invoke<I>(obj, std::forward<Args>(args)...);
+      }
+
+      // call a method by runtime index or name through a jump table, converting its result to R
+      template <typename R = void, typename Obj, typename... Args>
+      inline static R invoke( Obj& obj, std::size_t index, Args&&... args ) {
+         static_assert(detail::is_complete<meta_methods<C>>::value, "meta_object::invoke() requires bluegrass/meta/methods.hpp");
+         return meta_methods<C>::template invoke<R>(obj, index, std::forward<Args>(args)...);
+      }
+
+      template <typename R = void, typename Obj, typename... Args>
+      inline static R invoke( Obj& obj, std::string_view name, Args&&... args ) {
+         static_assert(detail::is_complete<meta_methods<C>>::value, "meta_object::invoke() requires bluegrass/meta/methods.hpp");
+         return meta_methods<C>::template invoke<R>(obj, name, std::forward<Args>(args)...);
       }
 
+      // for_each() over the fields of C and of all of its bases, see meta_hierarchy
       template <typename T, typename F>
       constexpr inline static void for_each_full( T& t, F&& f ) {
-         if constexpr (!std::is_same_v<super_t, C>)
-            meta_object<super_t>::for_each_full(static_cast<super_t&>(t), f);
-         for_each(t, f);
+         meta_hierarchy<C>::for_each(t, f);
       }
    };
 
@@ -193,28 +489,265 @@ namespace bluegrass { namespace meta {
    };
 
    namespace detail {
+      template <typename T>
+      struct is_tuple : std::false_type {};
       template <typename... Ts>
-      constexpr static inline bool is_tuple(std::tuple<Ts...>) { return true; }
+      struct is_tuple<std::tuple<Ts...>> : std::true_type {};
       template <typename T>
-      constexpr static inline bool is_tuple(T) { return false; }
+      constexpr static inline bool is_tuple_v = is_tuple<T>::value;
       template <typename T>
       constexpr static inline auto get_meta_object()
-         -> std::enable_if_t<has_member_valid_v<T> || is_tuple<T>(), meta_object<T>>;
+         -> std::enable_if_t<has_member_valid_v<T> || is_tuple_v<T>, meta_object<T>>;
    } // meta::refl::detail
 
    template <typename T>
    using meta_object_t = decltype(detail::get_meta_object<T>());
 
    template <typename T>
-   constexpr static inline bool has_meta_object_v = detail::has_member_valid_v<T> || detail::is_tuple<T>();
+   constexpr static inline bool has_meta_object_v = detail::has_member_valid_v<T> || detail::is_tuple_v<T>;
+
+   namespace detail {
+      template <typename... Bs>
+      struct bases_field_bytes<std::tuple<Bs...>> {
+         constexpr static inline std::size_t value = (std::size_t{0} + ... + meta_object<Bs>::field_bytes);
+      };
+
+      template <typename... Ts>
+      struct type_list_cat { using type = std::tuple<>; };
+
+      template <typename... As>
+      struct type_list_cat<std::tuple<As...>> { using type = std::tuple<As...>; };
+
+      template <typename... As, typename... Bs, typename... Rest>
+      struct type_list_cat<std::tuple<As...>, std::tuple<Bs...>, Rest...> : type_list_cat<std::tuple<As..., Bs...>, Rest...> {};
+
+      // every class of the hierarchy of C in field order: the bases depth first and in declaration order, then C
+      template <typename C, typename Bases = direct_bases_t<C>>
+      struct hierarchy_classes;
+
+      template <typename C, typename... Bs>
+      struct hierarchy_classes<C, std::tuple<Bs...>> {
+         using type = typename type_list_cat<typename hierarchy_classes<Bs>::type..., std::tuple<C>>::type;
+      };
+
+      template <typename T, std::size_t... Ns>
+      constexpr inline auto concat_arrays(const std::array<T, Ns>&... as) {
+         std::array<T, (std::size_t{0} + ... + Ns)> out = {};
+         std::size_t i = 0;
+         const auto append = [&](const auto& a) {
+            for (const auto& v : a)
+               out[i++] = v;
+         };
+         (append(as), ...);
+         return out;
+      }
+
+      template <typename C, typename F>
+      constexpr auto member_class(F C::*) -> C;
+
+      constexpr static inline std::size_t no_offset = static_cast<std::size_t>(-1);
+
+      // offset of the K subobject in C. The META_REFL offsets of K taken as offsetof(C, field) are relative
+      // to C, any field whose name isn't hidden in C (&C::field still names K's member) pins down the base.
+      template <typename C, typename K, std::size_t... Is>
+      constexpr inline std::size_t find_base_offset(std::index_sequence<Is...>) {
+         constexpr auto ptrs = K::template _meta_refl_field_mptrs<C>();
+         constexpr auto offs = K::template _meta_refl_field_offsets<C>();
+         std::size_t off = no_offset;
+         ((off = off == no_offset && std::is_same_v<decltype(member_class(std::get<Is>(ptrs))), K>
+               ? offs[Is] - meta_object<K>::layout[Is].offset : off), ...);
+         return off;
+      }
+
+      template <typename C, typename K>
+      constexpr inline std::size_t base_offset() {
+         if constexpr (std::is_same_v<C, K> || meta_object<K>::cardinality == 0) {
+            return 0;
+         } else {
+            constexpr std::size_t off = find_base_offset<C, K>(std::make_index_sequence<meta_object<K>::cardinality>{});
+            static_assert(off != no_offset, "every field of a base class is hidden in the derived class, its offset is unknown");
+            return off;
+         }
+      }
+
+      template <typename C, typename K>
+      constexpr inline auto hierarchy_offsets() {
+         std::array<std::size_t, meta_object<K>::cardinality> offs = {};
+         for (std::size_t i=0; i < offs.size(); i++)
+            offs[i] = base_offset<C, K>() + meta_object<K>::layout[i].offset;
+         return offs;
+      }
+
+      // the implicit base to derived member pointer conversion, so fields are reached without casting the object
+      template <typename C, typename F, typename K>
+      constexpr inline F C::* to_derived(F K::* p) { return p; }
+
+      template <typename C, typename K, std::size_t... Is>
+      constexpr inline auto derived_field_ptrs(std::index_sequence<Is...>) {
+         return std::make_tuple(to_derived<C>(std::get<Is>(meta_object<K>::field_ptrs))...);
+      }
+
+      template <typename C, typename Classes>
+      struct hierarchy_fields;
+
+      template <typename C, typename... Ks>
+      struct hierarchy_fields<C, std::tuple<Ks...>> {
+         using types   = typename type_list_cat<typename meta_object<Ks>::types...>::type;
+         using classes = typename type_list_cat<decltype(produce_tuple<Ks>(std::make_index_sequence<meta_object<Ks>::cardinality>{}))...>::type;
+         constexpr static inline auto names      = concat_arrays(meta_object<Ks>::names...);
+         constexpr static inline auto field_ptrs = std::tuple_cat(derived_field_ptrs<C, Ks>(std::make_index_sequence<meta_object<Ks>::cardinality>{})...);
+         constexpr static inline auto offsets    = concat_arrays(hierarchy_offsets<C, Ks>()...);
+      };
+   } // ns bluegrass::meta::detail
+
+   /**
+    * \struct meta_hierarchy
+    * The fields of C and of all of its bases as one compile time list: the fields of the bases come
+    * first (depth first, in the order of base_types_t), then the fields of C.
+    * Member pointers are converted to members of C and offsets are relative to C, so visiting the
+    * whole hierarchy is one flat fold with no per level casts or recursion, and runs of trivially
+    * copyable fields may span several classes.
+    * Fields are reached through their name in C: a base class whose every field is hidden by a field
+    * of the same name, or sibling bases with a field of the same name, aren't supported.
+    */
+   template <typename C>
+   struct meta_hierarchy : public meta_object_mixin<meta_hierarchy<C>> {
+      using mixin_t = meta_object_mixin<meta_hierarchy<C>>;
+      using mixin_t::for_each;
+      using this_t  = C;
+      using fields_t = detail::hierarchy_fields<C, typename detail::hierarchy_classes<C>::type>;
+      using types = typename fields_t::types;
+      template <std::size_t N>
+      using type = std::tuple_element_t<N, types>;
+      // the class that declares field N
+      template <std::size_t N>
+      using class_of = std::tuple_element_t<N, typename fields_t::classes>;
+      constexpr static inline std::size_t cardinality = std::tuple_size_v<types>;
+      constexpr static auto names = fields_t::names;
+      // tuple of pointers to data members of C, i.e. std::tuple<int C::*, float C::*, ...>
+      constexpr static auto field_ptrs = fields_t::field_ptrs;
+      // declared types of the fields, C arrays aren't decayed
+      using field_types = detail::member_types_t<decltype(field_ptrs)>;
+      template <std::size_t N>
+      using field_type = std::tuple_element_t<N, field_types>;
+
+      constexpr static auto layout = detail::make_layout<field_types>(fields_t::offsets, std::make_index_sequence<cardinality>{});
+      constexpr static auto trivial_runs = detail::make_runs<detail::count_runs(layout)>(layout);
+      constexpr static auto bitwise_runs = [](){
+         constexpr auto bl = detail::bitwise_layout<field_types>(layout, std::make_index_sequence<cardinality>{});
+         return detail::make_runs<detail::count_runs(bl)>(bl);
+      }();
+      constexpr static auto bitwise_run_heads = detail::run_heads<cardinality>(bitwise_runs);
+
+      template <std::size_t N>
+      constexpr static inline auto& get(C& c) {
+         return c.*std::get<N>(field_ptrs);
+      }
+
+      template <std::size_t N>
+      constexpr static inline const auto& get(const C& c) {
+         return c.*std::get<N>(field_ptrs);
+      }
+   };
+
+   namespace detail {
+      template <typename T>
+      struct array_element { using type = void; };
+      template <typename T, std::size_t N>
+      struct array_element<std::array<T, N>> { using type = T; };
+      template <typename T, std::size_t N>
+      struct array_element<T[N]> { using type = T; };
+
+      template <typename Types, std::size_t... Is>
+      constexpr inline bool all_bitwise(std::index_sequence<Is...>) {
+         return (is_bitwise<std::tuple_element_t<Is, Types>>() && ...);
+      }
+
+      // values are equal exactly when their bytes are: integral and enum scalars, and arrays and reflected
+      // types with no padding made only of such fields. Any other class may define its own equality.
+      template <typename T>
+      constexpr inline bool is_bitwise() {
+         if constexpr (!std::has_unique_object_representations_v<T>) {
+            return false;
+         } else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+            return true;
+         } else if constexpr (!std::is_void_v<typename array_element<T>::type>) {
+            return is_bitwise<typename array_element<T>::type>();
+         } else if constexpr (has_member_valid_v<T>) {
+            return meta_object<T>::field_bytes == sizeof(T) &&
+                   all_bitwise<typename meta_hierarchy<T>::field_types>(std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+         } else {
+            return false;
+         }
+      }
+
+      constexpr inline std::size_t align_up(std::size_t n, std::size_t alignment) {
+         return (n + alignment - 1) / alignment * alignment;
+      }
+
+      // the layout of the hierarchy in offset order, each gap counts as padding only up to the alignment of the
+      // field that follows (of C for the tail), anything beyond that is an unreflected member
+      template <typename C>
+      constexpr inline std::size_t padding_bytes() {
+         constexpr auto layout = meta_hierarchy<C>::layout;
+         constexpr std::size_t n = layout.size();
+         if constexpr (n == 0) {
+            return 0;
+         } else {
+            std::array<field_layout, n> sorted = layout;
+            for (std::size_t i=1; i < n; i++)
+               for (std::size_t j=i; j > 0 && sorted[j-1].offset > sorted[j].offset; j--) {
+                  const field_layout f = sorted[j];
+                  sorted[j] = sorted[j-1];
+                  sorted[j-1] = f;
+               }
+            std::size_t bytes = 0;
+            std::size_t end = sorted[0].offset + sorted[0].size;
+            for (std::size_t i=1; i < n; i++) {
+               if (sorted[i].offset > end)
+                  bytes += std::min(sorted[i].offset - end, align_up(end, sorted[i].alignment) - end);
+               end = std::max(end, sorted[i].offset + sorted[i].size);
+            }
+            if (sizeof(C) > end)
+               bytes += std::min(sizeof(C) - end, align_up(end, alignof(C)) - end);
+            return bytes;
+         }
+      }
+
+      // index of the member pointer p in the tuple ptrs, or the size of ptrs
+      template <typename Ptrs, typename P, std::size_t... Is>
+      constexpr inline std::size_t field_index_impl(const Ptrs& ptrs, P p, std::index_sequence<Is...>) {
+         std::size_t idx = sizeof...(Is);
+         const auto check = [&](std::size_t i, auto ptr) {
+            if constexpr (std::is_same_v<decltype(ptr), P>)
+               if (ptr == p)
+                  idx = i;
+         };
+         (check(Is, std::get<Is>(ptrs)), ...);
+         return idx;
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * Index of the reflected field pointed to by the data member pointer P, i.e. field_index_v<&foo::b> == 1.
+    */
+   template <auto P>
+   constexpr static inline std::size_t field_index_v = [](){
+      using class_t = decltype(detail::member_class(P));
+      using meta_t  = meta_object<class_t>;
+      constexpr std::size_t idx = detail::field_index_impl(meta_t::field_ptrs, P, std::make_index_sequence<meta_t::cardinality>{});
+      static_assert(idx < meta_t::cardinality, "member is not a reflected field of its class");
+      return idx;
+   }();
 
 }} // ns meta::refl
 
 #undef VALID_CONCEPT
 
-#define META_ADDRESS( ignore, FIELD ) (void*)&FIELD
+#define META_MEMBER_PTR( CLS, FIELD ) &CLS::FIELD
 #define META_DECLTYPE( ignore, FIELD ) decltype(FIELD)
 #define META_PASS_STR( ignore, X ) #X
+#define META_OFFSETOF( CLS, FIELD ) offsetof(CLS, FIELD)
 
 /**
  * @ingroup REFLECTION
@@ -234,17 +767,23 @@ namespace bluegrass { namespace meta {
 #define META_REFL(...)                                                      \
    public:                                                                  \
    constexpr inline auto& _meta_refl_get_this() { return *this; }           \
-   void _meta_refl_valid(){}                                                \
+   void _meta_refl_valid() const {}                                         \
    void _meta_refl_fields                                                   \
       ( META_FOREACH(META_DECLTYPE, "ignored", ##__VA_ARGS__) ){}           \
-   inline auto _meta_refl_field_ptrs() const {                              \
-      return std::array<void*, META_VA_ARGS_SIZE(__VA_ARGS__)>              \
-      {META_FOREACH(META_ADDRESS, "ignored", ##__VA_ARGS__)};               \
+   template <typename _meta_refl_cls>                                       \
+   constexpr inline static auto _meta_refl_field_mptrs() {                  \
+      return std::make_tuple(                                               \
+         META_FOREACH(META_MEMBER_PTR, _meta_refl_cls, ##__VA_ARGS__));     \
    }                                                                        \
-   template <std::size_t N>                                                 \
-   inline void* _meta_refl_field_ptr() const {                              \
-      return _meta_refl_field_ptrs()[N];                                    \
+   _Pragma("GCC diagnostic push")                                           \
+   _Pragma("GCC diagnostic ignored \"-Winvalid-offsetof\"")                 \
+   template <typename _meta_refl_cls>                                       \
+   constexpr inline static auto _meta_refl_field_offsets() {                \
+      return std::array<std::size_t, META_VA_ARGS_SIZE(__VA_ARGS__)> {      \
+         META_FOREACH(META_OFFSETOF, _meta_refl_cls, ##__VA_ARGS__)         \
+      };                                                                    \
    }                                                                        \
+   _Pragma("GCC diagnostic pop")                                            \
    constexpr inline static auto _meta_refl_field_names() {                  \
       return std::array<std::string_view, META_VA_ARGS_SIZE(__VA_ARGS__)> { \
          META_FOREACH(META_PASS_STR, "ignored", ##__VA_ARGS__)              \
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "hash.hpp"
+#include "json.hpp"
+#include "lookup.hpp"
+#include "refl.hpp"
+#include "serialize.hpp"
+#include "utility.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * \file registry.hpp
+ * Type erased runtime descriptions of reflected types.
+ *
+ * descriptor_v<T> is a constant built once per type: names, layout and per field function
+ * pointers, so dynamic code works on void pointers without instantiating templates per call site.
+ * Descriptors are entered into type_registry, a flat table indexed by a compact type id.
+ */
+
+namespace bluegrass { namespace meta {
+   using type_id_t = std::uint32_t;
+   constexpr static inline type_id_t invalid_type_id = std::numeric_limits<type_id_t>::max();
+
+   struct type_descriptor;
+
+   /**
+    * \struct base_descriptor
+    * A direct base of a reflected type and the offset of its subobject.
+    */
+   struct base_descriptor {
+      const type_descriptor* type;
+      std::size_t            offset;
+   };
+
+   /**
+    * \struct field_descriptor
+    * A reflected field, the function pointers take a pointer to the field itself. Each of them is
+    * nullptr when the field type doesn't support the operation, i.e. to_string and from_string for a
+    * std::map, hash for a type without std::hash or copy for a move only type.
+    */
+   struct field_descriptor {
+      std::string_view name;
+      std::string_view type_name;
+      std::size_t      offset;
+      std::size_t      size;
+      std::size_t      alignment;
+      // descriptor of the field type if it is reflected, nullptr otherwise
+      const type_descriptor* type;
+      // append the JSON encoding of the field to out
+      void (*to_string)(const void* field, std::string& out);
+      // decode the JSON text js into the field, throws json_error
+      void (*from_string)(void* field, std::string_view js);
+      std::uint64_t (*hash)(const void* field, std::uint64_t seed);
+      // copy assign src to dst
+      void (*copy)(void* dst, const void* src);
+   };
+
+   /**
+    * \struct type_descriptor
+    * A reflected type, fields holds only the fields declared by the type, the fields of its bases
+    * are reached through bases.
+    */
+   struct type_descriptor {
+      std::string_view name;
+      std::size_t      size;
+      std::size_t      alignment;
+      span<const field_descriptor> fields;
+      // the direct bases, super_t or every class of a base_types_t super_t
+      span<const base_descriptor> bases;
+      // index of the field called name or field_npos, through the perfect hash of lookup.hpp
+      std::size_t (*find)(std::string_view name);
+
+      inline const field_descriptor* field(std::string_view n) const {
+         const std::size_t idx = find(n);
+         return idx == field_npos ? nullptr : &fields[idx];
+      }
+
+      inline void* field_ptr(void* obj, std::size_t i) const { return static_cast<char*>(obj) + fields[i].offset; }
+      inline const void* field_ptr(const void* obj, std::size_t i) const { return static_cast<const char*>(obj) + fields[i].offset; }
+
+      inline void* base_ptr(void* obj, std::size_t i) const { return static_cast<char*>(obj) + bases[i].offset; }
+      inline const void* base_ptr(const void* obj, std::size_t i) const { return static_cast<const char*>(obj) + bases[i].offset; }
+   };
+
+   namespace detail {
+      template <typename T>
+      inline void field_to_string(const void* f, std::string& out) { to_json(*static_cast<const T*>(f), out); }
+
+      template <typename T>
+      inline void field_from_string(void* f, std::string_view js) { from_json(js, *static_cast<T*>(f)); }
+
+      template <typename T>
+      inline std::uint64_t field_hash(const void* f, std::uint64_t seed) { return hash_value(*static_cast<const T*>(f), seed); }
+
+      template <typename T>
+      inline void field_copy(void* dst, const void* src) { *static_cast<T*>(dst) = *static_cast<const T*>(src); }
+
+      // only instantiate the wrappers of the operations T supports
+      template <typename T>
+      constexpr inline auto field_to_string_of() -> void (*)(const void*, std::string&) {
+         if constexpr (json_writable<T>()) return &field_to_string<T>; else return nullptr;
+      }
+
+      template <typename T>
+      constexpr inline auto field_from_string_of() -> void (*)(void*, std::string_view) {
+         if constexpr (json_readable<T>()) return &field_from_string<T>; else return nullptr;
+      }
+
+      template <typename T>
+      constexpr inline auto field_hash_of() -> std::uint64_t (*)(const void*, std::uint64_t) {
+         if constexpr (hashable<T>()) return &field_hash<T>; else return nullptr;
+      }
+
+      template <typename T>
+      constexpr inline auto field_copy_of() -> void (*)(void*, const void*) {
+         if constexpr (std::is_copy_assignable_v<T>) return &field_copy<T>; else return nullptr;
+      }
+
+      template <typename T>
+      constexpr inline const type_descriptor* descriptor_of();
+
+      template <typename C, std::size_t I>
+      constexpr inline field_descriptor make_field_descriptor() {
+         using meta_t  = meta_object<C>;
+         // the declared type, type<I> decays C arrays
+         using field_t = std::remove_reference_t<decltype(meta_t::template get<I>(std::declval<C&>()))>;
+         return { meta_t::names[I], normalized_type_name<field_t>(), meta_t::layout[I].offset, sizeof(field_t),
+                  alignof(field_t), descriptor_of<field_t>(), field_to_string_of<field_t>(),
+                  field_from_string_of<field_t>(), field_hash_of<field_t>(), field_copy_of<field_t>() };
+      }
+
+      template <typename C, std::size_t... Is>
+      constexpr inline auto make_field_descriptors(std::index_sequence<Is...>) {
+         return std::array<field_descriptor, sizeof...(Is)>{ make_field_descriptor<C, Is>()... };
+      }
+
+      // external linkage, so every translation unit sees the same descriptor of a type
+      template <typename C>
+      constexpr inline auto field_descriptors_v = make_field_descriptors<C>(std::make_index_sequence<meta_object<C>::cardinality>{});
+
+      template <typename C, typename... Bs>
+      constexpr inline auto make_base_descriptors(std::tuple<Bs...>*) {
+         return std::array<base_descriptor, sizeof...(Bs)>{ base_descriptor{descriptor_of<Bs>(), base_offset<C, Bs>()}... };
+      }
+
+      template <typename C>
+      constexpr inline auto base_descriptors_v = make_base_descriptors<C>(static_cast<typename meta_object<C>::bases*>(nullptr));
+
+      template <typename C>
+      constexpr inline type_descriptor make_descriptor() {
+         return { meta_object<C>::this_name, sizeof(C), alignof(C),
+                  span<const field_descriptor>{field_descriptors_v<C>.data(), field_descriptors_v<C>.size()},
+                  span<const base_descriptor>{base_descriptors_v<C>.data(), base_descriptors_v<C>.size()},
+                  &find_field<C> };
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * The descriptor of the reflected type T.
+    */
+   template <typename T>
+   constexpr inline type_descriptor descriptor_v = detail::make_descriptor<T>();
+
+   namespace detail {
+      template <typename T>
+      constexpr inline const type_descriptor* descriptor_of() {
+         if constexpr (is_reflected_v<T>)
+            return &descriptor_v<T>;
+         else
+            return nullptr;
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * \class type_registry
+    * Flat table of descriptors indexed by type id, ids are handed out in registration order.
+    * Registration takes a lock, lookups by id only take a shared one.
+    */
+   class type_registry {
+      public:
+         static inline type_registry& instance() {
+            static type_registry reg;
+            return reg;
+         }
+
+         /**
+          * Register desc, returning its id. Registering the same descriptor again returns the same id,
+          * throws std::invalid_argument if another descriptor is registered under the same name
+          * (i.e. types of the same name in different anonymous namespaces).
+          */
+         inline type_id_t add(const type_descriptor* desc) {
+            std::unique_lock lock(_mtx);
+            if (auto it = _by_name.find(desc->name); it != _by_name.end()) {
+               if (_types[it->second] != desc)
+                  throw std::invalid_argument("type_registry: another type is registered under this name");
+               return it->second;
+            }
+            const type_id_t id = static_cast<type_id_t>(_types.size());
+            _types.push_back(desc);
+            _by_name.emplace(desc->name, id);
+            return id;
+         }
+
+         /**
+          * The descriptor registered as id, nullptr if there is none.
+          */
+         inline const type_descriptor* get(type_id_t id) const {
+            std::shared_lock lock(_mtx);
+            return id < _types.size() ? _types[id] : nullptr;
+         }
+
+         /**
+          * The id of the type called name (as in meta_object<T>::this_name), invalid_type_id if it isn't registered.
+          */
+         inline type_id_t find(std::string_view name) const {
+            std::shared_lock lock(_mtx);
+            const auto it = _by_name.find(name);
+            return it == _by_name.end() ? invalid_type_id : it->second;
+         }
+
+         inline std::size_t size() const {
+            std::shared_lock lock(_mtx);
+            return _types.size();
+         }
+
+      private:
+         type_registry() = default;
+
+         mutable std::shared_mutex                        _mtx;
+         std::vector<const type_descriptor*>               _types;
+         std::unordered_map<std::string_view, type_id_t> _by_name;
+   };
+
+   /**
+    * The compact id of T, registering T (but not its bases or fields) on first use.
+    */
+   template <typename T>
+   inline type_id_t type_id_of() {
+      static const type_id_t id = type_registry::instance().add(&descriptor_v<T>);
+      return id;
+   }
+
+   /**
+    * Register every type of Ts.
+    */
+   template <typename... Ts>
+   inline void register_types() {
+      (type_id_of<Ts>(), ...);
+   }
+}} // ns bluegrass::meta
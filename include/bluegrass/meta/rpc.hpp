@@ -0,0 +1,203 @@
+#pragma once
+
+#include "function_traits.hpp"
+#include "lookup.hpp"
+#include "serialize.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file rpc.hpp
+ * Binary RPC dispatch to free and member functions.
+ *
+ * A call is a method id and its arguments encoded as by serialize.hpp in parameter order, the
+ * result is the encoded return value (nothing for void). rpc_dispatcher holds a compile time table
+ * of {id, thunk} sorted by id, each thunk decodes the arguments straight into the decayed parameter
+ * types, calls the function and packs what it returns into the result buffer. Nothing is boxed
+ * and nothing is allocated besides what the parameter types themselves need: std::string_view
+ * parameters are views into the argument buffer, so prefer them over const std::string& for zero
+ * copy string arguments (both have the same encoding).
+ */
+
+namespace bluegrass { namespace meta {
+   using method_id_t = std::uint64_t;
+
+   /**
+    * Method id derived from a name, i.e. rpc_method<rpc_id("add"), &calc::add>.
+    */
+   constexpr inline method_id_t rpc_id(std::string_view name) { return detail::fnv1a(name); }
+
+   /**
+    * \struct rpc_method
+    * Fn, a pointer to a free function or to a member function, registered under Id.
+    */
+   template <method_id_t Id, auto Fn>
+   struct rpc_method {
+      constexpr static inline method_id_t id = Id;
+      constexpr static inline auto        fn = Fn;
+      using return_t = return_type_t<Fn>;
+      using params_t = flatten_parameters_t<Fn>;
+      // what the arguments are decoded into
+      using args_t   = decayed_flatten_parameters_t<Fn>;
+   };
+
+   namespace detail {
+      template <typename Service, typename Method, std::size_t... Is>
+      inline decltype(auto) rpc_invoke(Service& svc, typename Method::args_t& args, std::index_sequence<Is...>) {
+         constexpr auto fn = Method::fn;
+         if constexpr (std::is_member_function_pointer_v<decltype(fn)>)
+            return (svc.*fn)(static_cast<std::tuple_element_t<Is, typename Method::params_t>&&>(std::get<Is>(args))...);
+         else
+            return fn(static_cast<std::tuple_element_t<Is, typename Method::params_t>&&>(std::get<Is>(args))...);
+      }
+
+      template <typename Service, typename Method>
+      inline std::size_t rpc_thunk(Service& svc, span<const std::byte> in, span<std::byte> out) {
+         typename Method::args_t args;
+         byte_reader rd{in};
+         unpack(rd, args);
+         if (rd.remaining() != 0)
+            throw std::invalid_argument("rpc_dispatcher: trailing bytes after the arguments");
+         byte_writer wr{out};
+         constexpr auto seq = std::make_index_sequence<std::tuple_size_v<typename Method::args_t>>{};
+         if constexpr (std::is_void_v<typename Method::return_t>)
+            rpc_invoke<Service, Method>(svc, args, seq);
+         else
+            pack(wr, rpc_invoke<Service, Method>(svc, args, seq));
+         return wr.tellp();
+      }
+
+      template <typename Service>
+      struct rpc_entry {
+         method_id_t id;
+         std::size_t (*thunk)(Service&, span<const std::byte>, span<std::byte>);
+      };
+
+      template <typename Service, typename... Methods>
+      constexpr inline auto rpc_table() {
+         std::array<rpc_entry<Service>, sizeof...(Methods)> t = { rpc_entry<Service>{Methods::id, &rpc_thunk<Service, Methods>}... };
+         for (std::size_t i=1; i < t.size(); i++) {
+            for (std::size_t j=i; j > 0 && t[j].id < t[j-1].id; j--) {
+               const auto e = t[j];
+               t[j]   = t[j-1];
+               t[j-1] = e;
+            }
+         }
+         return t;
+      }
+
+      template <typename Table>
+      constexpr inline bool rpc_ids_unique(const Table& t) {
+         for (std::size_t i=1; i < t.size(); i++)
+            if (t[i].id == t[i-1].id)
+               return false;
+         return true;
+      }
+
+      template <typename Service, typename Method>
+      constexpr inline bool rpc_callable_on() {
+         if constexpr (std::is_member_function_pointer_v<decltype(Method::fn)>)
+            return std::is_base_of_v<class_from_member_t<Method::fn>, Service>;
+         else
+            return true;
+      }
+
+      template <typename Method, typename Stream, typename... Args, std::size_t... Is>
+      inline void pack_args(Stream& ds, std::index_sequence<Is...>, const Args&... args) {
+         (pack(ds, static_cast<const std::tuple_element_t<Is, typename Method::args_t>&>(args)), ...);
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * \class rpc_dispatcher
+    * Calls the method registered under an id with arguments decoded from a byte buffer.
+    * Member functions are called on the Service passed to dispatch(), Service is freestanding when
+    * every method is a free function.
+    */
+   template <typename Service, typename... Methods>
+   class rpc_dispatcher {
+      public:
+         using service_t = Service;
+         constexpr static inline std::size_t size = sizeof...(Methods);
+
+         static_assert((detail::rpc_callable_on<Service, Methods>() && ...), "member function of a class the service doesn't derive from");
+
+         static inline bool contains(method_id_t id) { return find(id) != nullptr; }
+
+         /**
+          * Decode the arguments of method id from args, call it on svc and encode its result into result.
+          * Throws std::invalid_argument for an unknown id or when args is longer than the arguments it
+          * encodes, and std::out_of_range when a buffer is too short.
+          * @return the number of bytes written to result
+          */
+         static inline std::size_t dispatch(Service& svc, method_id_t id, span<const std::byte> args, span<std::byte> result) {
+            const auto* e = find(id);
+            if (e == nullptr)
+               throw std::invalid_argument("rpc_dispatcher: unknown method id");
+            return e->thunk(svc, args, result);
+         }
+
+         template <typename S = Service, typename = std::enable_if_t<std::is_same_v<S, freestanding>>>
+         static inline std::size_t dispatch(method_id_t id, span<const std::byte> args, span<std::byte> result) {
+            freestanding svc;
+            return dispatch(svc, id, args, result);
+         }
+
+      private:
+         constexpr static inline auto _table = detail::rpc_table<Service, Methods...>();
+         static_assert(detail::rpc_ids_unique(_table), "two methods share an id");
+
+         static inline const detail::rpc_entry<Service>* find(method_id_t id) {
+            std::size_t lo = 0, hi = _table.size();
+            while (lo < hi) {
+               const std::size_t mid = (lo + hi) / 2;
+               if (_table[mid].id < id)
+                  lo = mid + 1;
+               else
+                  hi = mid;
+            }
+            return lo < _table.size() && _table[lo].id == id ? &_table[lo] : nullptr;
+         }
+   };
+
+   /**
+    * Number of bytes the arguments of a call to Method encode to.
+    */
+   template <typename Method, typename... Args>
+   inline std::size_t args_size(const Args&... args) {
+      static_assert(sizeof...(Args) == std::tuple_size_v<typename Method::args_t>, "wrong number of arguments");
+      byte_counter bc;
+      detail::pack_args<Method>(bc, std::index_sequence_for<Args...>{}, args...);
+      return bc.tellp();
+   }
+
+   /**
+    * Encode the arguments of a call to Method into buf, each converted to its decayed parameter type.
+    * @return the number of bytes written
+    */
+   template <typename Method, typename... Args>
+   inline std::size_t encode_args(span<std::byte> buf, const Args&... args) {
+      static_assert(sizeof...(Args) == std::tuple_size_v<typename Method::args_t>, "wrong number of arguments");
+      byte_writer ds{buf};
+      detail::pack_args<Method>(ds, std::index_sequence_for<Args...>{}, args...);
+      return ds.tellp();
+   }
+
+   /**
+    * Decode the result of a call to Method written by rpc_dispatcher::dispatch().
+    */
+   template <typename Method>
+   inline std::decay_t<typename Method::return_t> decode_result(span<const std::byte> buf) {
+      std::decay_t<typename Method::return_t> r;
+      deserialize(r, buf);
+      return r;
+   }
+}} // ns bluegrass::meta
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "lookup.hpp"
+#include "refl.hpp"
+#include "serialize.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file schema.hpp
+ * Compile time type ids and schema fingerprints.
+ *
+ * Both are 64 bit FNV-1a based hashes of normalized_type_name<T>() and of the field names, so they
+ * are the same for GCC and Clang builds and can be used as case labels of a dispatch switch or
+ * exchanged between processes to check that writer and reader agree on a layout.
+ */
+
+namespace bluegrass { namespace meta {
+   /**
+    * Stable id of T, the hash of its normalized type name.
+    */
+   template <typename T>
+   constexpr static inline std::uint64_t type_hash_v = detail::fnv1a(normalized_type_name<T>());
+
+   namespace detail {
+      template <typename T>
+      constexpr inline std::uint64_t schema_fingerprint();
+
+      constexpr inline std::uint64_t fingerprint_combine(std::uint64_t h, std::uint64_t v) {
+         return mix64(h ^ v) + 0x9e3779b97f4a7c15ull;
+      }
+
+      template <typename C, std::size_t... Is>
+      constexpr inline std::uint64_t fields_fingerprint(std::uint64_t h, std::index_sequence<Is...>) {
+         using meta_t = meta_hierarchy<C>;
+         ((h = fingerprint_combine(fingerprint_combine(h, fnv1a(meta_t::names[Is])),
+                                   schema_fingerprint<typename meta_t::template type<Is>>())), ...);
+         return h;
+      }
+
+      template <typename T, std::size_t... Is>
+      constexpr inline std::uint64_t tuple_fingerprint(std::index_sequence<Is...>) {
+         std::uint64_t h = fnv1a("tuple");
+         ((h = fingerprint_combine(h, schema_fingerprint<std::tuple_element_t<Is, T>>())), ...);
+         return fingerprint_combine(h, sizeof...(Is));
+      }
+
+      template <typename T>
+      constexpr inline std::uint64_t schema_fingerprint() {
+         if constexpr (is_reflected_v<T>) {
+            const std::uint64_t h = fields_fingerprint<T>(fnv1a("struct"), std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+            return fingerprint_combine(h, hierarchy_cardinality<T>());
+         } else if constexpr (is_tuple_v<T>) {
+            return tuple_fingerprint<T>(std::make_index_sequence<std::tuple_size_v<T>>{});
+         } else if constexpr (is_vector<T>::value) {
+            return fingerprint_combine(fnv1a("vector"), schema_fingerprint<typename T::value_type>());
+         } else if constexpr (is_string<T>::value) {
+            return fingerprint_combine(fnv1a("string"), schema_fingerprint<typename T::value_type>());
+         } else if constexpr (is_string_view<T>::value) {
+            return fingerprint_combine(fnv1a("string_view"), schema_fingerprint<typename T::value_type>());
+         } else if constexpr (is_std_array<T>::value) {
+            return fingerprint_combine(fingerprint_combine(fnv1a("array"), schema_fingerprint<typename T::value_type>()),
+                                       std::tuple_size_v<T>);
+         } else if constexpr (std::is_array_v<T>) {
+            return fingerprint_combine(fingerprint_combine(fnv1a("array"), schema_fingerprint<std::remove_extent_t<T>>()),
+                                       std::extent_v<T>);
+         } else {
+            return type_hash_v<T>;
+         }
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * Fingerprint of the schema of T: the names and types of all of its fields in order, base class
+    * fields first. Reflected field types contribute their own fingerprint rather than their name, also
+    * as elements of strings, vectors and arrays, so renaming a type keeps the fingerprint while
+    * renaming, reordering or retyping a field changes it, however deeply the field is nested.
+    */
+   template <typename T>
+   constexpr static inline std::uint64_t schema_fingerprint_v = detail::schema_fingerprint<T>();
+}} // ns bluegrass::meta
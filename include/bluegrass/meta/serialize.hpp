@@ -0,0 +1,504 @@
+#pragma once
+
+#include "refl.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file serialize.hpp
+ * Reflection driven binary serialization.
+ *
+ * Encoding (native byte order):
+ *    - reflected types are written field by field in meta_hierarchy order, base class fields first,
+ *      runs of adjacent and padding free trivially copyable fields are written as one block, even
+ *      when they belong to different classes of the hierarchy
+ *    - std::tuple elements are written in order
+ *    - std::string and std::vector are written as a uint32 length prefix followed by the elements,
+ *      std::string_view is written like std::string and decodes to a view into the input buffer
+ *    - any other trivially copyable type without padding bytes is written as its object
+ *      representation, padded classes must be reflected
+ *
+ * Decoding treats the input as untrusted: lengths are checked against the remaining input before
+ * anything is allocated, a bool byte other than 0 or 1 throws std::invalid_argument and only enums
+ * with a fixed underlying type, all of whose values are valid, can be decoded.
+ *
+ * Decoding with a std::pmr::memory_resource (i.e. a std::pmr::monotonic_buffer_resource) places
+ * the storage of every string and vector using a std::pmr::polymorphic_allocator into it, so a
+ * batch of records costs a few large allocations released together. Such containers still holding
+ * another resource are rebuilt empty on the decoding resource first, containers with any other
+ * allocator are decoded as usual.
+ */
+
+namespace bluegrass { namespace meta {
+   using length_prefix_t = std::uint32_t;
+
+   /**
+    * \class byte_writer
+    * Stream writing into a caller provided buffer, throws std::out_of_range on overrun.
+    */
+   class byte_writer {
+      public:
+         constexpr explicit byte_writer(span<std::byte> buf) : _buf(buf) {}
+
+         inline void write(const void* src, std::size_t n) {
+            if (n > remaining())
+               throw std::out_of_range("byte_writer: buffer overrun");
+            std::memcpy(_buf.data() + _pos, src, n);
+            _pos += n;
+         }
+
+         constexpr std::size_t tellp() const { return _pos; }
+         constexpr std::size_t remaining() const { return _buf.size() - _pos; }
+
+      private:
+         span<std::byte> _buf;
+         std::size_t     _pos = 0;
+   };
+
+   /**
+    * \class byte_reader
+    * Stream reading from a caller provided buffer, throws std::out_of_range on overrun.
+    */
+   class byte_reader {
+      public:
+         constexpr explicit byte_reader(span<const std::byte> buf, std::pmr::memory_resource* resource = nullptr)
+            : _buf(buf), _resource(resource) {}
+
+         inline void read(void* dst, std::size_t n) {
+            std::memcpy(dst, current(n), n);
+            _pos += n;
+         }
+
+         inline void skip(std::size_t n) {
+            current(n);
+            _pos += n;
+         }
+
+         // pointer to the next n bytes, without consuming them
+         inline const std::byte* current(std::size_t n = 0) const {
+            if (n > remaining())
+               throw std::out_of_range("byte_reader: buffer overrun");
+            return _buf.data() + _pos;
+         }
+
+         constexpr std::size_t tellg() const { return _pos; }
+         constexpr std::size_t remaining() const { return _buf.size() - _pos; }
+
+         // where std::pmr strings and vectors are decoded to, nullptr keeps their own resource
+         constexpr std::pmr::memory_resource* resource() const { return _resource; }
+
+      private:
+         span<const std::byte>       _buf;
+         std::size_t                 _pos = 0;
+         std::pmr::memory_resource*  _resource = nullptr;
+   };
+
+   /**
+    * \class byte_counter
+    * Stream that only counts the bytes that would be written.
+    */
+   class byte_counter {
+      public:
+         constexpr void write(const void*, std::size_t n) { _pos += n; }
+         constexpr std::size_t tellp() const { return _pos; }
+
+      private:
+         std::size_t _pos = 0;
+   };
+
+   namespace detail {
+      template <typename T>
+      struct is_string : std::false_type {};
+      template <typename C, typename Tr, typename A>
+      struct is_string<std::basic_string<C, Tr, A>> : std::true_type {};
+
+      template <typename T>
+      struct is_string_view : std::false_type {};
+      template <typename C, typename Tr>
+      struct is_string_view<std::basic_string_view<C, Tr>> : std::true_type {};
+
+      template <typename T>
+      struct is_vector : std::false_type {};
+      template <typename T, typename A>
+      struct is_vector<std::vector<T, A>> : std::true_type {};
+
+      // std::vector<bool> packs its bits and has no data()
+      template <typename T>
+      struct is_bool_vector : std::false_type {};
+      template <typename A>
+      struct is_bool_vector<std::vector<bool, A>> : std::true_type {};
+
+      template <typename T>
+      struct is_std_array : std::false_type {};
+      template <typename T, std::size_t N>
+      struct is_std_array<std::array<T, N>> : std::true_type {};
+
+      template <typename T, typename = void>
+      struct has_pmr_allocator : std::false_type {};
+      template <typename T>
+      struct has_pmr_allocator<T, std::void_t<typename T::allocator_type>>
+         : std::is_same<typename T::allocator_type, std::pmr::polymorphic_allocator<typename T::value_type>> {};
+
+      template <typename Stream, typename = void>
+      struct has_resource : std::false_type {};
+      template <typename Stream>
+      struct has_resource<Stream, std::void_t<decltype(std::declval<const Stream&>().resource())>> : std::true_type {};
+
+      template <typename T>
+      constexpr static inline bool is_reflected_v = has_member_valid_v<T>;
+
+      // addresses only mean something in the process that wrote them, decoding one from untrusted input
+      // would hand out a dereferenceable pointer
+      template <typename T>
+      struct is_address : std::bool_constant<std::is_pointer_v<T> || std::is_member_pointer_v<T>> {};
+      template <typename T, std::size_t N>
+      struct is_address<T[N]> : is_address<T> {};
+      template <typename T, std::size_t N>
+      struct is_address<std::array<T, N>> : is_address<T> {};
+
+      // every byte of the object representation is part of the value, so writing it leaks no uninitialized
+      // padding. Classes need unique object representations, padded ones must be reflected instead.
+      template <typename T>
+      constexpr inline bool padding_free() {
+         if constexpr (std::is_floating_point_v<T>)
+            return std::numeric_limits<T>::digits != 64; // x87 long double pads its 10 bytes
+         else if constexpr (std::is_scalar_v<T>)
+            return true;
+         else if constexpr (!std::is_void_v<typename array_element<T>::type>)
+            return padding_free<typename array_element<T>::type>();
+         else
+            return std::has_unique_object_representations_v<T>;
+      }
+
+      // written as the raw object representation
+      template <typename T>
+      constexpr static inline bool is_raw_v = std::is_trivially_copyable_v<T> && !is_reflected_v<T> && !is_string_view<T>::value &&
+                                              !is_address<T>::value && padding_free<T>();
+
+      // E{underlying} only compiles for enums with a fixed underlying type, all of whose values are valid
+      template <typename E, typename = void>
+      struct has_fixed_underlying : std::false_type {};
+      template <typename E>
+      struct has_fixed_underlying<E, std::void_t<decltype(E{std::declval<std::underlying_type_t<E>>()})>> : std::true_type {};
+
+      // some byte patterns aren't values of T (a bool other than 0 or 1, an enum without a fixed type out of
+      // its range), so T can't be copied from untrusted input
+      template <typename T>
+      constexpr inline bool has_invalid_bytes() {
+         if constexpr (std::is_same_v<T, bool>)
+            return true;
+         else if constexpr (std::is_enum_v<T>)
+            return !has_fixed_underlying<T>::value;
+         else if constexpr (!std::is_void_v<typename array_element<T>::type>)
+            return has_invalid_bytes<typename array_element<T>::type>();
+         else
+            return false;
+      }
+
+      // decoded with a single memcpy
+      template <typename T>
+      constexpr static inline bool is_memcpy_decodable_v = is_raw_v<T> && !has_invalid_bytes<T>();
+
+      // the layout of the hierarchy of C where only raw fields may take part in a block copy
+      template <typename C, std::size_t... Is>
+      constexpr inline auto wire_layout(std::index_sequence<Is...>) {
+         using meta_t = meta_hierarchy<C>;
+         auto layout = meta_t::layout;
+         ((layout[Is].trivially_copyable = layout[Is].trivially_copyable &&
+                                           is_memcpy_decodable_v<typename meta_t::template type<Is>>), ...);
+         return layout;
+      }
+
+      template <typename C>
+      constexpr inline auto wire_layout() {
+         return wire_layout<C>(std::make_index_sequence<meta_hierarchy<C>::cardinality>{});
+      }
+
+      template <typename C>
+      constexpr static inline auto wire_runs = make_runs<count_runs(wire_layout<C>())>(wire_layout<C>());
+
+      // for each field: 0 if not the head of a run, otherwise 1 + the index of the run it starts
+      template <typename C>
+      constexpr inline auto run_heads() {
+         std::array<std::size_t, meta_hierarchy<C>::cardinality> heads = {};
+         for (std::size_t r=0; r < wire_runs<C>.size(); r++)
+            heads[wire_runs<C>[r].first] = r + 1;
+         return heads;
+      }
+
+      template <typename C>
+      constexpr static inline auto wire_run_heads = run_heads<C>();
+
+      template <typename C, std::size_t N>
+      constexpr static inline bool in_wire_run_v = wire_layout<C>()[N].trivially_copyable;
+
+      template <typename C>
+      constexpr static inline bool has_super_v = std::tuple_size_v<typename meta_object<C>::bases> != 0;
+
+      // C has exactly one base, which is meta_object<C>::super_t
+      template <typename C>
+      constexpr static inline bool has_single_super_v = std::tuple_size_v<typename meta_object<C>::bases> == 1;
+
+      // number of fields of C including the fields of its bases
+      template <typename C>
+      constexpr inline std::size_t hierarchy_cardinality() {
+         return meta_hierarchy<C>::cardinality;
+      }
+   } // ns bluegrass::meta::detail
+
+   template <typename Stream, typename T>
+   inline void pack(Stream& ds, const T& v);
+
+   template <typename Stream, typename T>
+   inline void unpack(Stream& ds, T& v);
+
+   namespace detail {
+      template <typename Stream>
+      inline void pack_length(Stream& ds, std::size_t len) {
+         if (len > std::numeric_limits<length_prefix_t>::max())
+            throw std::length_error("length exceeds the length prefix");
+         const auto l = static_cast<length_prefix_t>(len);
+         ds.write(&l, sizeof(l));
+      }
+
+      template <typename Stream>
+      inline std::size_t unpack_length(Stream& ds) {
+         length_prefix_t l = 0;
+         ds.read(&l, sizeof(l));
+         return l;
+      }
+
+      // rebuild v empty on the resource of ds, as polymorphic_allocator doesn't propagate on assignment
+      template <typename Stream, typename T>
+      inline void use_resource(const Stream& ds, T& v) {
+         if constexpr (has_pmr_allocator<T>::value && has_resource<Stream>::value) {
+            std::pmr::memory_resource* mr = ds.resource();
+            if (mr != nullptr && v.get_allocator().resource() != mr) {
+               v.~T();
+               ::new (static_cast<void*>(&v)) T(typename T::allocator_type{mr});
+            }
+         }
+      }
+
+      template <typename C, std::size_t N, typename Stream>
+      inline void pack_field(Stream& ds, const C& c) {
+         if constexpr (wire_run_heads<C>[N] != 0) {
+            constexpr auto run = wire_runs<C>[wire_run_heads<C>[N]-1];
+            ds.write(reinterpret_cast<const char*>(&c) + run.offset, run.size);
+         } else if constexpr (!in_wire_run_v<C, N>) {
+            pack(ds, meta_hierarchy<C>::template get<N>(c));
+         }
+      }
+
+      template <typename C, std::size_t N, typename Stream>
+      inline void unpack_field(Stream& ds, C& c) {
+         if constexpr (wire_run_heads<C>[N] != 0) {
+            constexpr auto run = wire_runs<C>[wire_run_heads<C>[N]-1];
+            ds.read(reinterpret_cast<char*>(&c) + run.offset, run.size);
+         } else if constexpr (!in_wire_run_v<C, N>) {
+            unpack(ds, meta_hierarchy<C>::template get<N>(c));
+         }
+      }
+
+      // Is are indices into meta_hierarchy<C>, so the whole hierarchy is a single fold
+      template <typename C, typename Stream, std::size_t... Is>
+      inline void pack_fields(Stream& ds, const C& c, std::index_sequence<Is...>) {
+         (pack_field<C, Is>(ds, c), ...);
+      }
+
+      template <typename C, typename Stream, std::size_t... Is>
+      inline void unpack_fields(Stream& ds, C& c, std::index_sequence<Is...>) {
+         (unpack_field<C, Is>(ds, c), ...);
+      }
+
+      template <typename T>
+      constexpr inline bool fixed_size();
+
+      template <typename T>
+      constexpr inline std::size_t fixed_size_of();
+
+      template <typename Types, std::size_t... Is>
+      constexpr inline bool all_fixed_size(std::index_sequence<Is...>) {
+         return (fixed_size<std::tuple_element_t<Is, Types>>() && ...);
+      }
+
+      template <typename Types, std::size_t... Is>
+      constexpr inline std::size_t sum_fixed_size(std::index_sequence<Is...>) {
+         return (std::size_t{0} + ... + fixed_size_of<std::tuple_element_t<Is, Types>>());
+      }
+
+      template <typename T>
+      constexpr inline bool fixed_size() {
+         if constexpr (is_reflected_v<T> || is_tuple_v<T>) {
+            using meta_t = std::conditional_t<is_tuple_v<T>, meta_object<T>, meta_hierarchy<T>>;
+            return all_fixed_size<typename meta_t::types>(std::make_index_sequence<meta_t::cardinality>{});
+         } else if constexpr (is_std_array<T>::value) {
+            return fixed_size<typename T::value_type>();
+         } else {
+            return is_raw_v<T>;
+         }
+      }
+
+      template <typename T>
+      constexpr inline std::size_t fixed_size_of() {
+         if constexpr (is_reflected_v<T> || is_tuple_v<T>) {
+            using meta_t = std::conditional_t<is_tuple_v<T>, meta_object<T>, meta_hierarchy<T>>;
+            return sum_fixed_size<typename meta_t::types>(std::make_index_sequence<meta_t::cardinality>{});
+         } else if constexpr (is_std_array<T>::value && !is_raw_v<T>) {
+            return std::tuple_size_v<T> * fixed_size_of<typename T::value_type>();
+         } else {
+            return sizeof(T);
+         }
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * True if every value of T serializes to the same number of bytes.
+    */
+   template <typename T>
+   constexpr static inline bool is_fixed_size_v = detail::fixed_size<T>();
+
+   /**
+    * Number of bytes needed to serialize any value of the fixed size type T.
+    */
+   template <typename T>
+   constexpr inline std::size_t max_serialized_size() {
+      static_assert(is_fixed_size_v<T>, "max_serialized_size requires a fixed size type, use serialized_size(v)");
+      return detail::fixed_size_of<T>();
+   }
+
+   template <typename Stream, typename T>
+   inline void pack(Stream& ds, const T& v) {
+      static_assert(!detail::is_address<T>::value, "pointers and member pointers can't be serialized");
+      if constexpr (detail::is_reflected_v<T>) {
+         detail::pack_fields(ds, v, std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+      } else if constexpr (detail::is_tuple_v<T>) {
+         meta_object<T>::for_each(v, [&](const auto& e) { pack(ds, e); });
+      } else if constexpr (detail::is_string<T>::value || detail::is_string_view<T>::value) {
+         detail::pack_length(ds, v.size());
+         ds.write(v.data(), v.size() * sizeof(typename T::value_type));
+      } else if constexpr (detail::is_vector<T>::value) {
+         static_assert(!is_fixed_size_v<typename T::value_type> || detail::fixed_size_of<typename T::value_type>() != 0,
+                       "vectors of elements that encode to no bytes aren't serializable");
+         detail::pack_length(ds, v.size());
+         if constexpr (detail::is_raw_v<typename T::value_type>)
+            ds.write(v.data(), v.size() * sizeof(typename T::value_type));
+         else
+            for (const auto& e : v)
+               pack(ds, e);
+      } else if constexpr (detail::is_raw_v<T>) {
+         ds.write(&v, sizeof(T));
+      } else if constexpr (detail::is_std_array<T>::value || std::is_array_v<T>) {
+         for (const auto& e : v)
+            pack(ds, e);
+      } else {
+         static_assert(detail::is_raw_v<T>, "type is not serializable, trivially copyable types with padding must be reflected");
+      }
+   }
+
+   template <typename Stream, typename T>
+   inline void unpack(Stream& ds, T& v) {
+      static_assert(!detail::is_address<T>::value, "pointers and member pointers can't be deserialized");
+      if constexpr (detail::is_reflected_v<T>) {
+         detail::unpack_fields(ds, v, std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+      } else if constexpr (detail::is_tuple_v<T>) {
+         meta_object<T>::for_each(v, [&](auto& e) { unpack(ds, e); });
+      } else if constexpr (detail::is_string<T>::value) {
+         detail::use_resource(ds, v);
+         const std::size_t len = detail::unpack_length(ds);
+         const auto* data = ds.current(len * sizeof(typename T::value_type));
+         v.assign(reinterpret_cast<const typename T::value_type*>(data), len);
+         ds.skip(len * sizeof(typename T::value_type));
+      } else if constexpr (detail::is_string_view<T>::value) {
+         const std::size_t len = detail::unpack_length(ds);
+         v = T{reinterpret_cast<const typename T::value_type*>(ds.current(len * sizeof(typename T::value_type))), len};
+         ds.skip(len * sizeof(typename T::value_type));
+      } else if constexpr (detail::is_vector<T>::value) {
+         detail::use_resource(ds, v);
+         const std::size_t len = detail::unpack_length(ds);
+         if constexpr (detail::is_memcpy_decodable_v<typename T::value_type>) {
+            ds.current(len * sizeof(typename T::value_type));
+            v.resize(len);
+            ds.read(v.data(), len * sizeof(typename T::value_type));
+         } else {
+            // every element takes at least a byte (pack() refuses empty encodings), don't let a bogus length
+            // allocate before that fails
+            constexpr std::size_t min_size = is_fixed_size_v<typename T::value_type> ? detail::fixed_size_of<typename T::value_type>() : 1;
+            static_assert(min_size != 0, "vectors of elements that encode to no bytes aren't deserializable");
+            if (len > ds.remaining() / min_size)
+               throw std::out_of_range("unpack: vector length past the end of the input");
+            v.resize(len);
+            for (auto& e : v)
+               unpack(ds, e);
+         }
+      } else if constexpr (std::is_same_v<T, bool>) {
+         static_assert(sizeof(bool) == 1, "bool is written as its single byte");
+         std::uint8_t b = 0;
+         ds.read(&b, 1);
+         if (b > 1)
+            throw std::invalid_argument("unpack: invalid bool");
+         v = b != 0;
+      } else if constexpr (std::is_enum_v<T>) {
+         static_assert(detail::has_fixed_underlying<T>::value,
+                       "only enums with a fixed underlying type (enum E : int) are deserializable, other values may be out of range");
+         ds.read(&v, sizeof(T));
+      } else if constexpr (detail::is_memcpy_decodable_v<T>) {
+         ds.read(&v, sizeof(T));
+      } else if constexpr (detail::is_std_array<T>::value || std::is_array_v<T>) {
+         for (auto& e : v)
+            unpack(ds, e);
+      } else {
+         static_assert(detail::is_raw_v<T>, "type is not deserializable, trivially copyable types with padding must be reflected");
+      }
+   }
+
+   /**
+    * Number of bytes v serializes to.
+    */
+   template <typename T>
+   inline std::size_t serialized_size(const T& v) {
+      if constexpr (is_fixed_size_v<T>) {
+         return max_serialized_size<T>();
+      } else {
+         byte_counter bc;
+         pack(bc, v);
+         return bc.tellp();
+      }
+   }
+
+   /**
+    * Serialize v into buf.
+    * @return the number of bytes written
+    */
+   template <typename T>
+   inline std::size_t serialize(const T& v, span<std::byte> buf) {
+      byte_writer ds{buf};
+      pack(ds, v);
+      return ds.tellp();
+   }
+
+   /**
+    * Deserialize v from buf, std::pmr strings and vectors are allocated from resource when given.
+    * @return the number of bytes consumed
+    */
+   template <typename T>
+   inline std::size_t deserialize(T& v, span<const std::byte> buf, std::pmr::memory_resource* resource = nullptr) {
+      byte_reader ds{buf, resource};
+      unpack(ds, v);
+      return ds.tellg();
+   }
+}} // ns bluegrass::meta
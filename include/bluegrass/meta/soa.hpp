@@ -0,0 +1,105 @@
+#pragma once
+
+#include "refl.hpp"
+#include "utility.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file soa.hpp
+ */
+
+namespace bluegrass { namespace meta {
+   namespace detail {
+      template <typename Types>
+      struct soa_types;
+
+      template <typename... Ts>
+      struct soa_types<std::tuple<Ts...>> {
+         static_assert(!(std::is_same_v<Ts, bool> || ...), "bool fields can't be stored in a contiguous std::vector column");
+         using columns         = std::tuple<std::vector<Ts>...>;
+         using reference       = std::tuple<Ts&...>;
+         using const_reference = std::tuple<const Ts&...>;
+      };
+   } // ns bluegrass::meta::detail
+
+   /**
+    * \class meta_soa_vector
+    * Struct of arrays container for a reflected type, every field of T is stored in its own
+    * contiguous column.
+    * Rows are accessed through a tuple of references, so meta_object_t<reference>::for_each()
+    * visits the fields of a row.
+    */
+   template <typename T>
+   class meta_soa_vector {
+      public:
+         using meta_t = meta_object<T>;
+         using value_type = T;
+         using types  = typename meta_t::types;
+         template <std::size_t N>
+         using type   = typename meta_t::template type<N>;
+         using reference       = typename detail::soa_types<types>::reference;
+         using const_reference = typename detail::soa_types<types>::const_reference;
+         constexpr static inline std::size_t cardinality = meta_t::cardinality;
+
+         static_assert(std::is_same_v<typename meta_t::super_t, T>,
+                       "meta_soa_vector only stores the fields of T, types with a super_t are not supported");
+
+         /**
+          * Append v to every column, if copying a field throws no column is changed.
+          */
+         inline void push_back(const T& v) {
+            push_back_impl(v, std::make_index_sequence<cardinality>{});
+         }
+
+         inline void reserve(std::size_t n) {
+            std::apply([n](auto&... cols) { (cols.reserve(n), ...); }, _columns);
+         }
+
+         inline void clear() {
+            std::apply([](auto&... cols) { (cols.clear(), ...); }, _columns);
+         }
+
+         inline std::size_t size() const { return std::get<0>(_columns).size(); }
+         inline bool empty() const { return size() == 0; }
+
+         template <std::size_t N>
+         inline span<type<N>> column() { return std::get<N>(_columns); }
+
+         template <std::size_t N>
+         inline span<const type<N>> column() const { return std::get<N>(_columns); }
+
+         inline reference operator[](std::size_t i) {
+            return row<reference>(_columns, i, std::make_index_sequence<cardinality>{});
+         }
+
+         inline const_reference operator[](std::size_t i) const {
+            return row<const_reference>(_columns, i, std::make_index_sequence<cardinality>{});
+         }
+
+      private:
+         // vector::push_back() leaves the column that throws unchanged, so popping the columns that grew
+         // keeps every column the same length
+         template <std::size_t... Is>
+         inline void push_back_impl(const T& v, std::index_sequence<Is...>) {
+            const std::size_t n = size();
+            try {
+               (std::get<Is>(_columns).push_back(meta_t::template get<Is>(v)), ...);
+            } catch (...) {
+               ((std::get<Is>(_columns).size() > n ? std::get<Is>(_columns).pop_back() : void()), ...);
+               throw;
+            }
+         }
+
+         template <typename Ref, typename Columns, std::size_t... Is>
+         static inline Ref row(Columns& cols, std::size_t i, std::index_sequence<Is...>) {
+            return Ref{std::get<Is>(cols)[i]...};
+         }
+
+         typename detail::soa_types<types>::columns _columns;
+   };
+}} // ns bluegrass::meta
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "patch.hpp"
+#include "refl.hpp"
+#include "serialize.hpp"
+#include "utility.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file tracked.hpp
+ * Dirty tracking wrapper for reflected types.
+ *
+ * The dirty bits are laid out like the bitmask of patch.hpp (whole hierarchy, base class fields
+ * first), so the touched fields can be written as a patch and replayed with meta::apply().
+ */
+
+namespace bluegrass { namespace meta {
+   namespace detail {
+      // true if B is T or one of its (direct or indirect) bases
+      template <typename B, typename T, typename Classes = typename hierarchy_classes<T>::type>
+      constexpr static inline bool in_hierarchy_v = false;
+
+      template <typename B, typename T, typename... Ks>
+      constexpr static inline bool in_hierarchy_v<B, T, std::tuple<Ks...>> = (std::is_same_v<B, Ks> || ...);
+
+      template <typename T, auto Field, bool = std::is_member_object_pointer_v<decltype(Field)>>
+      struct tracked_class { using type = T; };
+
+      template <typename T, auto Field>
+      struct tracked_class<T, Field, true> { using type = decltype(member_class(Field)); };
+
+      // a field of T given by its index in meta_object<T> or by a data member pointer of T or a base,
+      // bit is its index in meta_hierarchy<T>
+      template <typename T, auto Field>
+      struct tracked_field {
+         using class_t = typename tracked_class<T, Field>::type;
+         static_assert(in_hierarchy_v<class_t, T>, "member does not belong to the tracked type or its bases");
+         constexpr static inline std::size_t bit = [](){
+            using meta_t = meta_hierarchy<T>;
+            if constexpr (std::is_member_object_pointer_v<decltype(Field)>) {
+               return field_index_impl(meta_t::field_ptrs, to_derived<T>(Field), std::make_index_sequence<meta_t::cardinality>{});
+            } else {
+               static_assert(static_cast<std::size_t>(Field) < meta_object<T>::cardinality, "field index out of range");
+               return meta_t::cardinality - meta_object<T>::cardinality + static_cast<std::size_t>(Field);
+            }
+         }();
+         static_assert(bit < meta_hierarchy<T>::cardinality, "member is not a reflected field");
+      };
+   } // ns bluegrass::meta::detail
+
+   /**
+    * \class tracked
+    * Wraps a reflected T and records which fields were written.
+    * Fields are named by their index in meta_object<T> or by a data member pointer of T or of one of
+    * its bases, i.e. set<0>(v) or set<&foo::a>(v).
+    * The mutable get() marks the field dirty up front, read through value() or the const get() to
+    * leave the dirty bits alone.
+    */
+   template <typename T>
+   class tracked {
+      public:
+         static_assert(detail::is_reflected_v<T>, "tracked requires a reflected type");
+         using value_type = T;
+         constexpr static inline std::size_t cardinality = detail::hierarchy_cardinality<T>();
+
+         tracked() = default;
+         explicit tracked(const T& v) : _value(v) {}
+         explicit tracked(T&& v) : _value(std::move(v)) {}
+
+         template <auto Field, typename V>
+         inline void set(V&& v) {
+            field<Field>(_value) = std::forward<V>(v);
+            mark<detail::tracked_field<T, Field>::bit>();
+         }
+
+         template <auto Field>
+         inline auto& get() {
+            mark<detail::tracked_field<T, Field>::bit>();
+            return field<Field>(_value);
+         }
+
+         template <auto Field>
+         inline const auto& get() const { return field<Field>(_value); }
+
+         inline const T& value() const { return _value; }
+
+         template <auto Field>
+         inline bool is_dirty() const { return detail::patch_bit(_dirty.data(), detail::tracked_field<T, Field>::bit); }
+
+         inline bool dirty() const {
+            for (auto b : _dirty)
+               if (b)
+                  return true;
+            return false;
+         }
+
+         inline std::size_t dirty_count() const {
+            std::size_t n = 0;
+            for (std::size_t i=0; i < cardinality; i++)
+               n += detail::patch_bit(_dirty.data(), i);
+            return n;
+         }
+
+         inline void clear_dirty() { _dirty = {}; }
+
+         /**
+          * Call f(name, field) for every dirty field, base class fields first.
+          */
+         template <typename F>
+         inline void for_each_dirty(F&& f) const {
+            for_each_dirty_impl(f, std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+         }
+
+         /**
+          * Write the dirty fields to buf in the patch.hpp encoding.
+          * @return the number of bytes written
+          */
+         inline std::size_t patch(span<std::byte> buf) const {
+            byte_writer ds{buf};
+            detail::pack_patch(ds, _value, _dirty);
+            return ds.tellp();
+         }
+
+         inline std::vector<std::byte> patch() const {
+            byte_counter bc;
+            detail::pack_patch(bc, _value, _dirty);
+            std::vector<std::byte> buf(bc.tellp());
+            patch(buf);
+            return buf;
+         }
+
+      private:
+         template <std::size_t Bit>
+         inline void mark() { _dirty[Bit / 8] |= static_cast<std::uint8_t>(1u << (Bit % 8)); }
+
+         template <auto Field, typename V>
+         static inline auto& field(V& v) {
+            return meta_hierarchy<T>::template get<detail::tracked_field<T, Field>::bit>(v);
+         }
+
+         template <typename F, std::size_t... Is>
+         inline void for_each_dirty_impl(F& f, std::index_sequence<Is...>) const {
+            using meta_t = meta_hierarchy<T>;
+            ((detail::patch_bit(_dirty.data(), Is) ? (void)f(meta_t::names[Is], meta_t::template get<Is>(_value)) : void()), ...);
+         }
+
+         T                     _value = {};
+         detail::patch_mask<T> _dirty = {};
+   };
+}} // ns bluegrass::meta
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 #include <tuple>
@@ -14,6 +15,40 @@ namespace bluegrass { namespace meta {
    template <class... Ts>
    overloaded(Ts...)->overloaded<Ts...>;
 
+   /**
+    * \class span
+    * Minimal non-owning view over contiguous memory (a stand in for C++20's std::span).
+    */
+   template <typename T>
+   class span {
+      public:
+         using element_type = T;
+         using value_type   = std::remove_cv_t<T>;
+         using iterator     = T*;
+
+         constexpr span() = default;
+         constexpr span(T* data, std::size_t size) : _data(data), _size(size) {}
+         template <std::size_t N>
+         constexpr span(T (&arr)[N]) : _data(arr), _size(N) {}
+         template <typename Container, typename = std::enable_if_t<
+            std::is_convertible_v<decltype(std::declval<Container&>().data()), T*>>>
+         constexpr span(Container& c) : _data(c.data()), _size(c.size()) {}
+
+         constexpr T* data() const { return _data; }
+         constexpr std::size_t size() const { return _size; }
+         constexpr bool empty() const { return _size == 0; }
+         constexpr T* begin() const { return _data; }
+         constexpr T* end() const { return _data + _size; }
+         constexpr T& operator[](std::size_t i) const { return _data[i]; }
+
+         constexpr span subspan(std::size_t offset) const { return {_data + offset, _size - offset}; }
+         constexpr span subspan(std::size_t offset, std::size_t count) const { return {_data + offset, count}; }
+
+      private:
+         T*          _data = nullptr;
+         std::size_t _size = 0;
+   };
+
    template <char... Str>
    struct ct_string {
       constexpr static const char value[] = {Str..., '\0'};
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "lookup.hpp"
+#include "refl.hpp"
+#include "schema.hpp"
+#include "serialize.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * \file versioned.hpp
+ * Schema versioned binary encoding for exchanging reflected types between builds that may disagree
+ * on their fields.
+ *
+ * Encoding (native byte order):
+ *    - header: uint64 schema_fingerprint_v<T>, uint32 body size, uint32 field count F
+ *    - body: the serialize.hpp encoding of the value
+ *    - directory: F entries of {uint32 tag, uint32 offset of the field in the body}, the tag hashes
+ *      the field name together with the fingerprint of its type, which covers the fields of nested
+ *      and container element types
+ *
+ * A reader with the same fingerprint decodes the body directly (runs of trivially copyable fields are
+ * block copies) and skips the directory. Otherwise each of its fields is looked up by tag in the
+ * directory: fields the writer doesn't have, or has with another type, keep their current value and
+ * fields only the writer has are never visited.
+ */
+
+namespace bluegrass { namespace meta {
+   namespace detail {
+      struct versioned_header {
+         std::uint64_t fingerprint;
+         std::uint32_t body_size;
+         std::uint32_t field_count;
+      };
+
+      constexpr static inline std::size_t versioned_header_size = sizeof(std::uint64_t) + 2 * sizeof(std::uint32_t);
+      constexpr static inline std::size_t versioned_entry_size  = 2 * sizeof(std::uint32_t);
+
+      // Is are indices into meta_hierarchy<C>, which are also the indices of the directory
+      template <typename C, std::size_t... Is>
+      constexpr inline auto versioned_tags(std::index_sequence<Is...>) {
+         using meta_t = meta_hierarchy<C>;
+         return std::array<std::uint32_t, sizeof...(Is)>{ static_cast<std::uint32_t>(
+               fingerprint_combine(fnv1a(meta_t::names[Is]), schema_fingerprint<typename meta_t::template type<Is>>()))... };
+      }
+
+      template <typename T>
+      constexpr static inline auto versioned_tags_v = versioned_tags<T>(std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+
+      template <typename Stream, typename C, std::size_t... Is>
+      inline void pack_versioned_fields(Stream& ds, const C& c, std::size_t body, std::uint32_t* offsets, std::index_sequence<Is...>) {
+         using meta_t = meta_hierarchy<C>;
+         ((offsets[Is] = static_cast<std::uint32_t>(ds.tellp() - body),
+           pack(ds, meta_t::template get<Is>(c))), ...);
+      }
+
+      inline std::uint32_t versioned_dir_read(span<const std::byte> dir, std::size_t i, std::size_t word) {
+         std::uint32_t v;
+         std::memcpy(&v, dir.data() + i * versioned_entry_size + word * sizeof(v), sizeof(v));
+         return v;
+      }
+
+      // body offset of the field tagged tag or field_npos, i is where it is when the field lists agree
+      inline std::size_t find_versioned_offset(span<const std::byte> dir, std::uint32_t tag, std::size_t i) {
+         const std::size_t n = dir.size() / versioned_entry_size;
+         if (i < n && versioned_dir_read(dir, i, 0) == tag)
+            return versioned_dir_read(dir, i, 1);
+         for (std::size_t j=0; j < n; j++)
+            if (versioned_dir_read(dir, j, 0) == tag)
+               return versioned_dir_read(dir, j, 1);
+         return field_npos;
+      }
+
+      template <typename C, std::size_t... Is>
+      inline void unpack_versioned_fields(C& c, span<const std::byte> body, span<const std::byte> dir, std::pmr::memory_resource* resource,
+                                          std::index_sequence<Is...>) {
+         using meta_t = meta_hierarchy<C>;
+         const auto read = [&](std::size_t i, auto& field) {
+            const std::size_t offset = find_versioned_offset(dir, versioned_tags_v<C>[i], i);
+            if (offset == field_npos)
+               return;
+            if (offset > body.size())
+               throw std::out_of_range("versioned directory offset past the body");
+            byte_reader ds{body.subspan(offset), resource};
+            unpack(ds, field);
+         };
+         (read(Is, meta_t::template get<Is>(c)), ...);
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * Number of bytes v serializes to with serialize_versioned().
+    */
+   template <typename T>
+   inline std::size_t versioned_size(const T& v) {
+      return detail::versioned_header_size + serialized_size(v) + detail::hierarchy_cardinality<T>() * detail::versioned_entry_size;
+   }
+
+   /**
+    * Serialize v into buf with a schema header and field directory.
+    * @return the number of bytes written
+    */
+   template <typename T>
+   inline std::size_t serialize_versioned(const T& v, span<std::byte> buf) {
+      static_assert(detail::is_reflected_v<T>, "serialize_versioned requires a reflected type");
+      constexpr std::size_t fields = detail::hierarchy_cardinality<T>();
+      std::array<std::uint32_t, fields> offsets = {};
+
+      byte_writer ds{buf};
+      std::array<std::byte, detail::versioned_header_size> header = {};
+      ds.write(header.data(), header.size());
+      detail::pack_versioned_fields(ds, v, detail::versioned_header_size, offsets.data(), std::make_index_sequence<fields>{});
+      const std::size_t body_size = ds.tellp() - detail::versioned_header_size;
+      if (body_size > std::numeric_limits<std::uint32_t>::max())
+         throw std::length_error("versioned body exceeds 4GiB");
+      for (std::size_t i=0; i < fields; i++) {
+         ds.write(&detail::versioned_tags_v<T>[i], sizeof(std::uint32_t));
+         ds.write(&offsets[i], sizeof(std::uint32_t));
+      }
+
+      const detail::versioned_header h = {schema_fingerprint_v<T>, static_cast<std::uint32_t>(body_size), static_cast<std::uint32_t>(fields)};
+      byte_writer hs{buf};
+      hs.write(&h.fingerprint, sizeof(h.fingerprint));
+      hs.write(&h.body_size, sizeof(h.body_size));
+      hs.write(&h.field_count, sizeof(h.field_count));
+      return ds.tellp();
+   }
+
+   /**
+    * True if buf was written with the same schema as T, i.e. deserialize_versioned() takes the fast path.
+    */
+   template <typename T>
+   inline bool versioned_matches(span<const std::byte> buf) {
+      std::uint64_t fingerprint;
+      byte_reader{buf}.read(&fingerprint, sizeof(fingerprint));
+      return fingerprint == schema_fingerprint_v<T>;
+   }
+
+   /**
+    * Deserialize v from buf written by serialize_versioned() with any version of T, std::pmr strings
+    * and vectors are allocated from resource when given.
+    * @return the number of bytes consumed
+    */
+   template <typename T>
+   inline std::size_t deserialize_versioned(T& v, span<const std::byte> buf, std::pmr::memory_resource* resource = nullptr) {
+      static_assert(detail::is_reflected_v<T>, "deserialize_versioned requires a reflected type");
+      byte_reader ds{buf};
+      detail::versioned_header h;
+      ds.read(&h.fingerprint, sizeof(h.fingerprint));
+      ds.read(&h.body_size, sizeof(h.body_size));
+      ds.read(&h.field_count, sizeof(h.field_count));
+
+      const span<const std::byte> body{ds.current(h.body_size), h.body_size};
+      ds.skip(h.body_size);
+      const std::size_t dir_size = std::size_t{h.field_count} * detail::versioned_entry_size;
+      const span<const std::byte> dir{ds.current(dir_size), dir_size};
+      ds.skip(dir_size);
+
+      if (h.fingerprint == schema_fingerprint_v<T>)
+         deserialize(v, body, resource);
+      else
+         detail::unpack_versioned_fields(v, body, dir, resource, std::make_index_sequence<meta_hierarchy<T>::cardinality>{});
+      return ds.tellg();
+   }
+}} // ns bluegrass::meta
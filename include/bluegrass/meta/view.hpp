@@ -0,0 +1,224 @@
+#pragma once
+
+#include "refl.hpp"
+#include "serialize.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file view.hpp
+ * Zero copy read access to reflected types stored in a fixed layout encoding.
+ *
+ * Encoding (native byte order), every field has a slot at a compile time offset:
+ *    - base class fields (via super_t) come first, then the fields of the class in order
+ *    - trivially copyable fields occupy sizeof(field) bytes
+ *    - reflected fields are inlined with their own fixed layout
+ *    - std::string fields (of char, wide strings aren't supported) occupy a uint32 offset (from the start of the record) and a uint32 length,
+ *      the characters are stored after the fixed part of the record
+ */
+
+namespace bluegrass { namespace meta {
+   template <typename T>
+   class meta_view;
+
+   namespace detail {
+      struct view_string_slot {
+         std::uint32_t offset;
+         std::uint32_t size;
+      };
+
+      // strings of char only, the slot length is a byte count and get() returns a std::string_view
+      template <typename F>
+      struct is_view_string : std::false_type {};
+      template <typename Tr, typename A>
+      struct is_view_string<std::basic_string<char, Tr, A>> : std::true_type {};
+      template <typename F>
+      constexpr static inline bool is_view_string_v = is_view_string<F>::value;
+
+      template <typename T>
+      constexpr inline std::size_t view_fixed_size();
+
+      template <typename F>
+      constexpr inline std::size_t view_slot_size() {
+         if constexpr (is_reflected_v<F>)
+            return view_fixed_size<F>();
+         else if constexpr (is_view_string_v<F>)
+            return sizeof(view_string_slot);
+         else {
+            static_assert(is_raw_v<F>, "meta_view only supports trivially copyable, std::string and reflected fields, not wide strings");
+            return sizeof(F);
+         }
+      }
+
+      template <typename T>
+      constexpr inline std::size_t view_super_size() {
+         static_assert(!has_super_v<T> || has_single_super_v<T>, "meta_view supports a single super_t, not base_types_t");
+         if constexpr (has_super_v<T>)
+            return view_fixed_size<typename meta_object<T>::super_t>();
+         else
+            return 0;
+      }
+
+      template <typename T, std::size_t... Is>
+      constexpr inline auto view_offsets(std::index_sequence<Is...>) {
+         std::array<std::size_t, sizeof...(Is)+1> offsets = { view_super_size<T>() };
+         std::size_t i = 0;
+         ((offsets[i+1] = offsets[i] + view_slot_size<typename meta_object<T>::template type<Is>>(), i++), ...);
+         return offsets;
+      }
+
+      // slot offset of each field followed by the size of the fixed part
+      template <typename T>
+      constexpr static inline auto view_offsets_v = view_offsets<T>(std::make_index_sequence<meta_object<T>::cardinality>{});
+
+      template <typename T>
+      constexpr inline std::size_t view_fixed_size() {
+         return view_offsets_v<T>[meta_object<T>::cardinality];
+      }
+
+      template <typename T>
+      inline std::size_t view_tail_size(const T& v) {
+         std::size_t size = 0;
+         if constexpr (has_super_v<T>)
+            size += view_tail_size(static_cast<const typename meta_object<T>::super_t&>(v));
+         meta_object<T>::for_each(v, [&](const auto& f) {
+            using field_t = std::decay_t<decltype(f)>;
+            if constexpr (is_reflected_v<field_t>)
+               size += view_tail_size(f);
+            else if constexpr (is_view_string_v<field_t>)
+               size += f.size();
+         });
+         return size;
+      }
+
+      template <typename T, std::size_t... Is>
+      inline void write_view_fields(std::byte* base, std::byte* fixed, std::size_t& tail, const T& v, std::index_sequence<Is...>);
+
+      template <typename T>
+      inline void write_view_fixed(std::byte* base, std::byte* fixed, std::size_t& tail, const T& v) {
+         if constexpr (has_super_v<T>)
+            write_view_fixed(base, fixed, tail, static_cast<const typename meta_object<T>::super_t&>(v));
+         write_view_fields(base, fixed, tail, v, std::make_index_sequence<meta_object<T>::cardinality>{});
+      }
+
+      template <typename T, std::size_t... Is>
+      inline void write_view_fields(std::byte* base, std::byte* fixed, std::size_t& tail, const T& v, std::index_sequence<Is...>) {
+         const auto write_field = [&](std::byte* slot, const auto& f) {
+            using field_t = std::decay_t<decltype(f)>;
+            if constexpr (is_reflected_v<field_t>) {
+               write_view_fixed(base, slot, tail, f);
+            } else if constexpr (is_view_string_v<field_t>) {
+               const view_string_slot s = { static_cast<std::uint32_t>(tail), static_cast<std::uint32_t>(f.size()) };
+               std::memcpy(slot, &s, sizeof(s));
+               std::memcpy(base + tail, f.data(), f.size());
+               tail += f.size();
+            } else {
+               std::memcpy(slot, &f, sizeof(f));
+            }
+         };
+         (write_field(fixed + view_offsets_v<T>[Is], meta_object<T>::template get<Is>(v)), ...);
+      }
+   } // ns bluegrass::meta::detail
+
+   /**
+    * Number of bytes v occupies in the fixed layout encoding.
+    */
+   template <typename T>
+   inline std::size_t view_size(const T& v) {
+      return detail::view_fixed_size<T>() + detail::view_tail_size(v);
+   }
+
+   /**
+    * Write v into buf with the fixed layout encoding read by meta_view<T>.
+    * @return the number of bytes written
+    */
+   template <typename T>
+   inline std::size_t write_view(const T& v, span<std::byte> buf) {
+      const std::size_t size = view_size(v);
+      if (size > buf.size())
+         throw std::out_of_range("write_view: buffer overrun");
+      if (size > std::numeric_limits<std::uint32_t>::max())
+         throw std::length_error("write_view: record exceeds the string offset range");
+      std::size_t tail = detail::view_fixed_size<T>();
+      detail::write_view_fixed(buf.data(), buf.data(), tail, v);
+      return size;
+   }
+
+   /**
+    * \class meta_view
+    * Read only view over a reflected type T written by write_view().
+    * Fields are read directly from the buffer at compile time offsets, nothing is decoded up front.
+    * The buffer has to outlive the view and any std::string_view returned from it.
+    * String slots are read from the buffer, so each is checked against the buffer size before use.
+    */
+   template <typename T>
+   class meta_view {
+      public:
+         using meta_t = meta_object<T>;
+         using this_t = T;
+         using types  = typename meta_t::types;
+         template <std::size_t N>
+         using type   = typename meta_t::template type<N>;
+         constexpr static inline std::size_t cardinality = meta_t::cardinality;
+         constexpr static inline auto names = meta_t::names;
+         // size of the fixed part of the encoding, strings are stored after it
+         constexpr static inline std::size_t fixed_size = detail::view_fixed_size<T>();
+
+         explicit meta_view(span<const std::byte> buf) : _base(buf.data()), _data(buf.data()), _size(buf.size()) {
+            if (_size < fixed_size)
+               throw std::out_of_range("meta_view: buffer smaller than the fixed part of the record");
+         }
+         constexpr meta_view(const std::byte* base, const std::byte* data, std::size_t size) : _base(base), _data(data), _size(size) {}
+
+         /**
+          * Read field N, trivially copyable fields are returned by value, std::string fields as a
+          * std::string_view into the buffer and reflected fields as a meta_view.
+          */
+         template <std::size_t N>
+         inline auto get() const {
+            using field_t = type<N>;
+            const std::byte* slot = _data + detail::view_offsets_v<T>[N];
+            if constexpr (detail::is_reflected_v<field_t>) {
+               return meta_view<field_t>{_base, slot, _size};
+            } else if constexpr (detail::is_view_string_v<field_t>) {
+               detail::view_string_slot s;
+               std::memcpy(&s, slot, sizeof(s));
+               // written as offset > size - s.size would wrap for a corrupt s.size
+               if (s.offset > _size || s.size > _size - s.offset)
+                  throw std::out_of_range("meta_view: string slot outside the buffer");
+               return std::string_view{reinterpret_cast<const char*>(_base + s.offset), s.size};
+            } else {
+               field_t f;
+               std::memcpy(&f, slot, sizeof(f));
+               return f;
+            }
+         }
+
+         /**
+          * View of the base class (super_t) portion of the record.
+          */
+         inline auto super() const {
+            static_assert(detail::has_super_v<T>, "type has no super_t");
+            return meta_view<typename meta_t::super_t>{_base, _data, _size};
+         }
+
+         constexpr const std::byte* data() const { return _data; }
+         // size of the whole buffer the record was read from
+         constexpr std::size_t size() const { return _size; }
+
+      private:
+         const std::byte* _base;
+         const std::byte* _data;
+         std::size_t      _size;
+   };
+}} // ns bluegrass::meta
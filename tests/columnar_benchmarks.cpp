@@ -0,0 +1,75 @@
+#include <bluegrass/meta/columnar.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct trade {
+      std::uint64_t ts = 0;
+      std::uint64_t id = 0;
+      double        price = 0;
+      double        fee = 0;
+      std::uint32_t size = 0;
+      std::uint32_t venue = 0;
+      META_REFL(ts, id, price, fee, size, venue);
+   };
+
+   std::vector<std::byte> read_file(const std::string& path) {
+      std::ifstream in{path, std::ios::binary};
+      std::vector<std::byte> buf(std::filesystem::file_size(path));
+      in.read(reinterpret_cast<char*>(buf.data()), static_cast<std::streamsize>(buf.size()));
+      return buf;
+   }
+} // ns anonymous
+
+TEST_CASE("Benchmark columnar mmap reads against a row encoding", "[columnar_benchmarks]") {
+   const auto dir = std::filesystem::temp_directory_path();
+   const std::string col_path = (dir / "meta_refl_columnar_bench.col").string();
+   const std::string row_path = (dir / "meta_refl_columnar_bench.row").string();
+
+   std::vector<trade> trades(1 << 20);
+   for (std::size_t i=0; i < trades.size(); i++)
+      trades[i] = {i, i * 7, 100.0 + i % 50, 0.01, static_cast<std::uint32_t>(i % 1000), static_cast<std::uint32_t>(i % 8)};
+   {
+      columnar_writer<trade> w{col_path};
+      for (const auto& t : trades)
+         w.append(t);
+      std::vector<std::byte> buf(serialized_size(trades));
+      serialize(trades, buf);
+      std::ofstream out{row_path, std::ios::binary};
+      out.write(reinterpret_cast<const char*>(buf.data()), static_cast<std::streamsize>(buf.size()));
+   }
+
+   BENCHMARK("row encoding: read, decode and sum price") {
+      const auto buf = read_file(row_path);
+      std::vector<trade> out;
+      deserialize(out, buf);
+      double sum = 0;
+      for (const auto& t : out)
+         sum += t.price;
+      return sum;
+   };
+
+   BENCHMARK("columnar: map and sum price") {
+      columnar_file<trade> f{col_path};
+      double sum = 0;
+      f.for_each_block<2>([&](span<const double> prices) {
+         for (auto p : prices)
+            sum += p;
+      });
+      return sum;
+   };
+
+   std::remove(col_path.c_str());
+   std::remove(row_path.c_str());
+}
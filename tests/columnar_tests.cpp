@@ -0,0 +1,169 @@
+#include <bluegrass/meta/columnar.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct stamp {
+      std::uint64_t ts = 0;
+      META_REFL(ts);
+   };
+
+   struct tick : stamp {
+      using super_t = stamp;
+      double        price = 0;
+      std::uint32_t size  = 0;
+      char          side  = 'b';
+      META_REFL(price, size, side);
+   };
+
+   struct other {
+      double        price = 0;
+      std::uint32_t size  = 0;
+      META_REFL(price, size);
+   };
+
+   struct named {
+      std::uint64_t id = 0;
+      std::string   name;
+      META_REFL(id, name);
+   };
+
+   struct linked {
+      std::uint64_t id = 0;
+      const linked* next = nullptr;
+      META_REFL(id, next);
+   };
+
+   std::string temp_path(const char* name) {
+      return (std::filesystem::temp_directory_path() / name).string();
+   }
+
+   tick make_tick(std::uint64_t i) {
+      tick t;
+      t.ts    = 1000 + i;
+      t.price = 0.5 * i;
+      t.size  = static_cast<std::uint32_t>(i * 3);
+      t.side  = i % 2 ? 's' : 'b';
+      return t;
+   }
+} // ns anonymous
+
+TEST_CASE("Testing columnar write and read", "[columnar_tests]") {
+   static_assert( detail::columnar_storable<tick>(std::make_index_sequence<meta_hierarchy<tick>::cardinality>{}) );
+   // neither a std::string nor a pointer may be reinterpreted from file bytes
+   static_assert( !detail::columnar_storable<named>(std::make_index_sequence<2>{}) );
+   static_assert( !detail::columnar_storable<linked>(std::make_index_sequence<2>{}) );
+
+   const std::string path = temp_path("meta_refl_columnar_tests.col");
+   {
+      columnar_writer<tick> w{path, 100};
+      for (std::uint64_t i=0; i < 250; i++)
+         w.append(make_tick(i));
+      REQUIRE( w.size() == 250 );
+   }
+
+   columnar_file<tick> f{path};
+   REQUIRE( f.size() == 250 );
+   REQUIRE( f.block_count() == 3 );
+   REQUIRE( f.block_size(0) == 100 );
+   REQUIRE( f.block_size(2) == 50 );
+
+   // the schema in the footer
+   const auto& footer = f.footer();
+   REQUIRE( footer.fingerprint == schema_fingerprint_v<tick> );
+   REQUIRE( footer.type == normalized_type_name<tick>() );
+   REQUIRE( footer.fields.size() == 4 );
+   REQUIRE( footer.fields[0].name == "ts" );
+   REQUIRE( footer.fields[0].type == normalized_type_name<std::uint64_t>() );
+   REQUIRE( footer.fields[1].name == "price" );
+   REQUIRE( footer.fields[2].size == sizeof(std::uint32_t) );
+   REQUIRE( footer.fields[3].name == "side" );
+
+   // columns are aligned spans into the mapping
+   const auto prices = f.column<1>(1);
+   REQUIRE( prices.size() == 100 );
+   REQUIRE( reinterpret_cast<std::uintptr_t>(prices.data()) % columnar_alignment == 0 );
+   REQUIRE( prices[0] == 50.0 );
+   REQUIRE( f.column<0>(2)[49] == 1249 );
+   REQUIRE( f.column<3>(0)[1] == 's' );
+
+   std::uint64_t total = 0;
+   f.for_each_block<2>([&](span<const std::uint32_t> sizes) {
+      for (auto s : sizes)
+         total += s;
+   });
+   REQUIRE( total == 3 * (249 * 250 / 2) );
+
+   const tick t = f[123];
+   REQUIRE( t.ts == 1123 );
+   REQUIRE( t.price == 61.5 );
+   REQUIRE( t.size == 369 );
+   REQUIRE( t.side == 's' );
+   REQUIRE( f.at(249).ts == 1249 );
+   REQUIRE_THROWS_AS( f.at(250), std::out_of_range );
+
+   // moving keeps the mapping alive
+   columnar_file<tick> g = std::move(f);
+   REQUIRE( g.column<1>(1)[0] == 50.0 );
+   std::remove(path.c_str());
+}
+
+TEST_CASE("Testing columnar format errors", "[columnar_error_tests]") {
+   const std::string path = temp_path("meta_refl_columnar_error_tests.col");
+   {
+      columnar_writer<tick> w{path};
+      w.append(make_tick(1));
+   }
+   REQUIRE_THROWS_AS( columnar_file<other>{path}, std::invalid_argument );
+
+   // a footer claiming another field size
+   for (std::uint32_t size : {0u, 4u}) {
+      std::vector<std::byte> file(std::filesystem::file_size(path));
+      std::ifstream{path, std::ios::binary}.read(reinterpret_cast<char*>(file.data()), static_cast<std::streamsize>(file.size()));
+      std::uint64_t footer_offset;
+      std::memcpy(&footer_offset, file.data() + file.size() - 16, sizeof(footer_offset));
+      columnar_footer footer;
+      deserialize(footer, span<const std::byte>{file.data() + footer_offset, file.size() - 16 - footer_offset});
+      footer.fields[0].size = size;
+      std::vector<std::byte> corrupt(file.begin(), file.begin() + footer_offset);
+      corrupt.resize(footer_offset + serialized_size(footer));
+      serialize(footer, span<std::byte>{corrupt.data() + footer_offset, corrupt.size() - footer_offset});
+      corrupt.insert(corrupt.end(), file.end() - 16, file.end());
+      const std::string corrupt_path = temp_path("meta_refl_columnar_corrupt.col");
+      std::ofstream{corrupt_path, std::ios::binary}.write(reinterpret_cast<const char*>(corrupt.data()), static_cast<std::streamsize>(corrupt.size()));
+      REQUIRE_THROWS_AS( columnar_file<tick>{corrupt_path}, std::invalid_argument );
+      std::remove(corrupt_path.c_str());
+   }
+
+   // truncated, the trailer is gone
+   std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+   REQUIRE_THROWS_AS( columnar_file<tick>{path}, std::invalid_argument );
+
+   {
+      std::ofstream out{path, std::ios::binary | std::ios::trunc};
+      out << "not a columnar file at all";
+   }
+   REQUIRE_THROWS_AS( columnar_file<tick>{path}, std::invalid_argument );
+   std::remove(path.c_str());
+
+   REQUIRE_THROWS_AS( columnar_file<tick>{path}, std::system_error );
+
+   // an empty file has no blocks
+   {
+      columnar_writer<tick> w{path};
+   }
+   REQUIRE( columnar_file<tick>{path}.size() == 0 );
+   std::remove(path.c_str());
+}
@@ -0,0 +1,153 @@
+#include <bluegrass/meta/compare.hpp>
+#include <bluegrass/meta/hash.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct record {
+      std::uint32_t id    = 0;
+      std::int32_t  delta = 0;
+      std::uint64_t seq   = 0;
+      double        score = 0;
+      std::string   name;
+      META_REFL(id, delta, seq, score, name);
+      META_REFL_OPERATORS(record);
+   };
+
+   struct tagged_record : record {
+      using super_t = record;
+      std::vector<record> children;
+      std::uint16_t tag = 0;
+      META_REFL(children, tag);
+   };
+
+   // bytes differ between equal values
+   struct ci_char {
+      char c = 0;
+      bool operator==(const ci_char& o) const { return std::tolower(c) == std::tolower(o.c); }
+   };
+
+   struct labeled {
+      std::uint32_t id = 0;
+      ci_char       initial;
+      std::uint32_t count = 0;
+      META_REFL(id, initial, count);
+   };
+} // ns anonymous
+
+template <>
+struct std::hash<ci_char> {
+   std::size_t operator()(const ci_char& v) const { return std::hash<int>{}(std::tolower(v.c)); }
+};
+
+TEST_CASE("Testing reflected equality", "[compare_equal_tests]") {
+   record r1{1, -2, 3, 0.0, "a"};
+   record r2 = r1;
+   REQUIRE( equal(r1, r2) );
+   REQUIRE( r1 == r2 );
+
+   r2.score = -0.0;
+   REQUIRE( equal(r1, r2) );
+
+   r2.delta = 2;
+   REQUIRE( !equal(r1, r2) );
+   REQUIRE( r1 != r2 );
+
+   r2 = r1;
+   r2.name = "b";
+   REQUIRE( !equal(r1, r2) );
+
+   tagged_record t1;
+   static_cast<record&>(t1) = r1;
+   t1.children = {r1, r1};
+   t1.tag = 7;
+   tagged_record t2 = t1;
+   REQUIRE( equal(t1, t2) );
+   t2.seq++;
+   REQUIRE( !equal(t1, t2) );
+   t2 = t1;
+   t2.children[1].id++;
+   REQUIRE( !equal(t1, t2) );
+   t2 = t1;
+   t2.tag++;
+   REQUIRE( !equal(t1, t2) );
+
+   REQUIRE( equal(std::make_tuple(1, std::string("x")), std::make_tuple(1, std::string("x"))) );
+   REQUIRE( !equal(std::make_tuple(1, std::string("x")), std::make_tuple(1, std::string("y"))) );
+
+   std::unordered_set<record, meta::hash<record>, meta::equal_to<record>> set = { r1, r1, r2 };
+   REQUIRE( set.size() == 2 );
+}
+
+TEST_CASE("Testing reflected ordering", "[compare_order_tests]") {
+   // the id/delta/seq run differs in byte order from value order on little endian targets
+   record a{0x100, 0, 0, 0, ""};
+   record b{0x001, 0, 0, 0, ""};
+   REQUIRE( compare(a, b) > 0 );
+   REQUIRE( compare(b, a) < 0 );
+   REQUIRE( b < a );
+   REQUIRE( a >= b );
+
+   record c{1, -1, 0, 0, ""};
+   record d{1,  1, 0, 0, ""};
+   REQUIRE( c < d );
+   REQUIRE( compare(c, c) == 0 );
+
+   record e{1, 1, 0, 1.5, "a"};
+   record f{1, 1, 0, 1.5, "b"};
+   REQUIRE( e < f );
+   REQUIRE( f > e );
+   REQUIRE( e <= e );
+
+   tagged_record t1;
+   tagged_record t2;
+   t1.children = {c};
+   t2.children = {c, c};
+   REQUIRE( compare(t1, t2) < 0 );
+   t1.id = 2;
+   REQUIRE( compare(t1, t2) > 0 );
+
+   REQUIRE( compare(std::make_tuple(1, 2.0), std::make_tuple(1, 3.0)) < 0 );
+
+   std::vector<record> rs = { f, d, a, c, b, e };
+   std::sort(rs.begin(), rs.end(), meta::less<record>{});
+   REQUIRE( equal(rs[0], c) );
+   REQUIRE( equal(rs[1], b) );
+   REQUIRE( equal(rs[2], d) );
+   REQUIRE( equal(rs[3], e) );
+   REQUIRE( equal(rs[4], f) );
+   REQUIRE( equal(rs[5], a) );
+
+   std::set<record, meta::less<record>> ordered(rs.begin(), rs.end());
+   REQUIRE( ordered.size() == rs.size() );
+}
+
+TEST_CASE("Testing classes with their own equality", "[compare_user_equality_tests]") {
+   static_assert( std::has_unique_object_representations_v<ci_char> );
+   static_assert( !detail::is_bitwise<ci_char>() );
+   // id and count don't form a run through initial
+   REQUIRE( meta_object<labeled>::bitwise_runs.size() == 2 );
+
+   const labeled a{1, {'A'}, 2};
+   const labeled b{1, {'a'}, 2};
+   REQUIRE( equal(a, b) );
+   REQUIRE( hash_value(a) == hash_value(b) );
+   REQUIRE( !equal(a, labeled{1, {'b'}, 2}) );
+
+   const std::vector<bool> bits = {true, false, true};
+   REQUIRE( equal(bits, std::vector<bool>{true, false, true}) );
+   REQUIRE( !equal(bits, std::vector<bool>{true, true, true}) );
+   REQUIRE( hash_value(bits) == hash_value(std::vector<bool>{true, false, true}) );
+}
@@ -0,0 +1,76 @@
+# ##################################################################################################
+# Measures compile time and compiler memory of META_REFL as the number of fields grows.
+# Run through the meta_refl_compile_benchmarks target, or directly with
+#    cmake -DCXX=<compiler> -DINCLUDE_DIR=<include dir> -DWORK_DIR=<scratch dir> -P compile_benchmarks.cmake
+# Wall time needs CMake 3.23 or newer for sub second timestamps, memory is reported by GCC and
+# clang through -ftime-report.
+# ##################################################################################################
+if(NOT FIELD_COUNTS)
+   set(FIELD_COUNTS 8 16 32 64 96 128)
+endif()
+
+file(MAKE_DIRECTORY ${WORK_DIR})
+message("fields   wall (s)   compiler memory")
+
+foreach(n ${FIELD_COUNTS})
+   set(decls "")
+   set(names "")
+   math(EXPR last "${n} - 1")
+   foreach(i RANGE ${last})
+      string(APPEND decls "   int f${i} = ${i};\n")
+      if(i EQUAL 0)
+         string(APPEND names "f${i}")
+      else()
+         string(APPEND names ", f${i}")
+      endif()
+   endforeach()
+
+   set(src ${WORK_DIR}/fields_${n}.cpp)
+   file(WRITE ${src}
+"#include <bluegrass/meta/refl.hpp>\n\n\
+struct wide {\n${decls}   META_REFL(${names});\n};\n\n\
+int sum(wide& w) {\n\
+   int total = 0;\n\
+   bluegrass::meta::meta_object<wide>::for_each(w, [&](int& f) { total += f; });\n\
+   return total + static_cast<int>(bluegrass::meta::meta_object<wide>::names.size());\n\
+}\n")
+
+   string(TIMESTAMP start "%s%f" UTC)
+   execute_process(COMMAND ${CXX} -std=c++17 -O2 -ftime-report -I${INCLUDE_DIR} -c ${src} -o ${WORK_DIR}/fields_${n}.o
+                   RESULT_VARIABLE result
+                   OUTPUT_VARIABLE report
+                   ERROR_VARIABLE report)
+   string(TIMESTAMP stop "%s%f" UTC)
+
+   if(NOT result EQUAL 0)
+      message(FATAL_ERROR "compiling ${n} fields failed:\n${report}")
+   endif()
+
+   # %f is not expanded before CMake 3.23, fall back to whole seconds
+   if(start MATCHES "^[0-9]+$" AND stop MATCHES "^[0-9]+$")
+      math(EXPR micros "${stop} - ${start}")
+      math(EXPR secs "${micros} / 1000000")
+      math(EXPR frac "(${micros} % 1000000) / 1000")
+      string(LENGTH "${frac}" len)
+      if(len EQUAL 1)
+         set(frac "00${frac}")
+      elseif(len EQUAL 2)
+         set(frac "0${frac}")
+      endif()
+      set(wall "${secs}.${frac}")
+   else()
+      string(REGEX REPLACE "%f.*" "" start "${start}")
+      string(REGEX REPLACE "%f.*" "" stop "${stop}")
+      math(EXPR wall "${stop} - ${start}")
+   endif()
+
+   # GCC: "TOTAL : ... <n>k", clang: "Total ... <n> bytes"
+   set(memory "n/a")
+   if(report MATCHES "TOTAL[^\n]* ([0-9]+[kMG])[ \t]*\n")
+      set(memory "${CMAKE_MATCH_1}")
+   elseif(report MATCHES "Total[^\n]* ([0-9]+) bytes")
+      set(memory "${CMAKE_MATCH_1} bytes")
+   endif()
+
+   message("${n}\t ${wall}\t    ${memory}")
+endforeach()
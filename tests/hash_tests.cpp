@@ -0,0 +1,84 @@
+#include <bluegrass/meta/hash.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct key {
+      std::uint32_t a = 0;
+      std::uint32_t b = 0;
+      std::uint64_t c = 0;
+      double        d = 0;
+      std::uint16_t e = 0;
+      std::string   name;
+      META_REFL(a, b, c, d, e, name);
+
+      bool operator==(const key& o) const {
+         return a == o.a && b == o.b && c == o.c && d == o.d && e == o.e && name == o.name;
+      }
+   };
+
+   struct derived_key : key {
+      using super_t = key;
+      std::vector<int> path;
+      META_REFL(path);
+   };
+} // ns anonymous
+
+TEST_CASE("Testing bitwise runs", "[hash_runs_tests]") {
+   using key_meta = meta_object<key>;
+   // a, b and c are hashed as one range, double is excluded because 0.0 == -0.0
+   REQUIRE( key_meta::bitwise_runs.size() == 2 );
+   REQUIRE( key_meta::bitwise_runs[0].first == 0 );
+   REQUIRE( key_meta::bitwise_runs[0].count == 3 );
+   REQUIRE( key_meta::bitwise_runs[0].size == 16 );
+   REQUIRE( key_meta::bitwise_runs[1].first == 4 );
+   REQUIRE( key_meta::bitwise_run_heads[0] == 1 );
+   REQUIRE( key_meta::bitwise_run_heads[1] == 0 );
+   REQUIRE( key_meta::bitwise_run_heads[4] == 2 );
+}
+
+TEST_CASE("Testing reflected hashing", "[hash_value_tests]") {
+   key k1{1, 2, 3, 0.0, 5, "name"};
+   key k2 = k1;
+   REQUIRE( hash<key>{}(k1) == hash<key>{}(k2) );
+
+   k2.d = -0.0;
+   REQUIRE( k1 == k2 );
+   REQUIRE( hash<key>{}(k1) == hash<key>{}(k2) );
+
+   for (auto mutate : std::vector<void(*)(key&)>{ [](key& k) { k.a++; }, [](key& k) { k.c++; },
+                                                  [](key& k) { k.d = 1; }, [](key& k) { k.e++; },
+                                                  [](key& k) { k.name += "!"; } }) {
+      key k3 = k1;
+      mutate(k3);
+      REQUIRE( hash<key>{}(k1) != hash<key>{}(k3) );
+   }
+
+   REQUIRE( hash_value(k1, 1) != hash_value(k1, 2) );
+
+   derived_key d1;
+   static_cast<key&>(d1) = k1;
+   d1.path = {1, 2};
+   derived_key d2 = d1;
+   REQUIRE( hash_value(d1) == hash_value(d2) );
+   d2.a++;
+   REQUIRE( hash_value(d1) != hash_value(d2) );
+
+   REQUIRE( hash_value(std::make_tuple(1, std::string("x"))) == hash_value(std::make_tuple(1, std::string("x"))) );
+   REQUIRE( hash_value(std::string("abc")) == hash_value(std::string_view("abc")) );
+
+   std::unordered_set<key, hash<key>> set;
+   for (std::uint32_t i=0; i < 100; i++)
+      set.insert(key{i, i, i, 0, 0, "k"});
+   set.insert(key{7, 7, 7, -0.0, 0, "k"});
+   REQUIRE( set.size() == 100 );
+   REQUIRE( set.count(key{42, 42, 42, 0, 0, "k"}) == 1 );
+}
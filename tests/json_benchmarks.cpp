@@ -0,0 +1,60 @@
+#include <bluegrass/meta/json.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct telemetry {
+      std::uint64_t ts = 0;
+      std::string   host;
+      std::int32_t  cpu = 0;
+      double        load = 0;
+      bool          healthy = false;
+      META_REFL(ts, host, cpu, load, healthy);
+   };
+} // ns anonymous
+
+TEST_CASE("Benchmark json writer against an ostream for_each writer", "[json_write_benchmarks]") {
+   telemetry t = {1700000000123, "node-17.example", 42, 0.73, true};
+
+   BENCHMARK("ostringstream + for_each") {
+      std::ostringstream os;
+      std::size_t i = 0;
+      os << '{';
+      meta_object<telemetry>::for_each(t, [&](const auto& v) {
+         if (i != 0)
+            os << ',';
+         os << '"' << meta_object<telemetry>::names[i++] << "\":";
+         if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::string>)
+            os << '"' << v << '"';
+         else
+            os << v;
+      });
+      os << '}';
+      return os.str().size();
+   };
+
+   std::string buf;
+   buf.reserve(256);
+   BENCHMARK("to_json into a reused buffer") {
+      buf.clear();
+      to_json(t, buf);
+      return buf.size();
+   };
+}
+
+TEST_CASE("Benchmark json reader", "[json_read_benchmarks]") {
+   const std::string js = R"({"ts":1700000000123,"host":"node-17.example","cpu":42,"load":0.73,"healthy":true,"extra":{"a":[1,2,3]}})";
+   telemetry t;
+
+   BENCHMARK("from_json into a reused object") {
+      from_json(js, t);
+      return t.cpu;
+   };
+}
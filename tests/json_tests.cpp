@@ -0,0 +1,178 @@
+#include <bluegrass/meta/json.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   enum class side : std::uint8_t { buy = 1, sell = 2 };
+
+   struct point {
+      int x = 0;
+      int y = 0;
+      META_REFL(x, y);
+   };
+
+   struct empty_event {
+      META_REFL();
+   };
+
+   struct event {
+      std::uint64_t id = 0;
+      std::string   msg;
+      bool          ok = false;
+      side          s = side::buy;
+      double        value = 0;
+      point         pos;
+      std::vector<int> samples;
+      std::tuple<int, std::string> extra;
+      META_REFL(id, msg, ok, s, value, pos, samples, extra);
+   };
+
+   struct derived_event : event {
+      using super_t = event;
+      float weight = 0;
+      META_REFL(weight);
+   };
+
+   // x hides point::x, such types can't be written or read
+   struct shadowing_point : point {
+      using super_t = point;
+      int x = 0;
+      META_REFL(x);
+   };
+} // ns anonymous
+
+TEST_CASE("Testing json key fragments", "[json_keys_tests]") {
+   REQUIRE( detail::json_keys<point>::fragment<0>() == "{\"x\":" );
+   REQUIRE( detail::json_keys<point>::fragment<1>() == ",\"y\":" );
+   // keys span the hierarchy, the fields of the base come first
+   REQUIRE( detail::json_keys<derived_event>::fragment<0>() == "{\"id\":" );
+   REQUIRE( detail::json_keys<derived_event>::fragment<8>() == ",\"weight\":" );
+   static_assert( detail::json_names_unique(meta_hierarchy<derived_event>::names) );
+   static_assert( !detail::json_names_unique(meta_hierarchy<shadowing_point>::names) );
+}
+
+TEST_CASE("Testing json writer", "[json_writer_tests]") {
+   derived_event e;
+   e.id = 7;
+   e.msg = "line\n\"quoted\"\x01";
+   e.ok = true;
+   e.s = side::sell;
+   e.value = 0.5;
+   e.pos = {1, -2};
+   e.samples = {3, 4};
+   e.extra = {5, "five"};
+   e.weight = 2.25f;
+
+   REQUIRE( to_json(e) == "{\"id\":7,\"msg\":\"line\\n\\\"quoted\\\"\\u0001\",\"ok\":true,\"s\":2,\"value\":0.5,"
+                          "\"pos\":{\"x\":1,\"y\":-2},\"samples\":[3,4],\"extra\":[5,\"five\"],\"weight\":2.25}" );
+
+   REQUIRE( to_json(empty_event{}) == "{}" );
+   REQUIRE( to_json(std::numeric_limits<double>::infinity()) == "null" );
+
+   // C string fields, a null one is written as null
+   const char* cs = nullptr;
+   REQUIRE( to_json(cs) == "null" );
+   cs = "c";
+   REQUIRE( to_json(cs) == "\"c\"" );
+   REQUIRE( to_json(std::tuple<const char*, int>{nullptr, 1}) == "[null,1]" );
+
+   std::vector<char> buf;
+   buf.reserve(256);
+   const auto* data = buf.data();
+   for (int i=0; i < 4; i++) {
+      buf.clear();
+      to_json(point{i, i}, buf);
+   }
+   REQUIRE( std::string(buf.begin(), buf.end()) == "{\"x\":3,\"y\":3}" );
+   REQUIRE( buf.data() == data );
+}
+
+TEST_CASE("Testing json reader", "[json_reader_tests]") {
+   derived_event e;
+   e.msg.reserve(128);
+   const auto* msg_data = e.msg.data();
+   from_json(R"( { "weight" : 1.5, "id": 42, "unknown": {"a": [1, 2.5e10, "x\"y", null, true, {}]},
+                   "msg": "a\nbé😀\"", "ok": true, "s": 2, "value": -0.125,
+                   "pos": {"y": 9, "x": -8}, "samples": [1, 2, 3], "extra": [7, "seven"],
+                   "id2": 5 } )", e);
+   REQUIRE( e.weight == 1.5f );
+   REQUIRE( e.id == 42 );
+   REQUIRE( e.msg == "a\nb\xc3\xa9\xf0\x9f\x98\x80\"" );
+   REQUIRE( e.msg.data() == msg_data );
+   REQUIRE( e.ok );
+   REQUIRE( e.s == side::sell );
+   REQUIRE( e.value == -0.125 );
+   REQUIRE( e.pos.x == -8 );
+   REQUIRE( e.pos.y == 9 );
+   REQUIRE( e.samples == std::vector<int>{1, 2, 3} );
+   REQUIRE( std::get<0>(e.extra) == 7 );
+   REQUIRE( std::get<1>(e.extra) == "seven" );
+
+   // round trip through the writer
+   derived_event e2;
+   from_json(to_json(e), e2);
+   REQUIRE( to_json(e2) == to_json(e) );
+
+   // escaped keys still find their field
+   point p;
+   from_json(R"({"\u0078": 3, "y": 4})", p);
+   REQUIRE( p.x == 3 );
+   REQUIRE( p.y == 4 );
+
+   from_json("{}", p);
+   REQUIRE( p.x == 3 );
+
+   REQUIRE_THROWS_AS( from_json(R"({"x": 1,})", p), json_error );
+   REQUIRE_THROWS_AS( from_json(R"({"x": "1"})", p), json_error );
+   REQUIRE_THROWS_AS( from_json(R"({"x": 1} x)", p), json_error );
+   REQUIRE_THROWS_AS( from_json(R"({"x": 99999999999})", p), json_error );
+   REQUIRE_THROWS_AS( from_json(R"({"x": 1)", p), json_error );
+}
+
+TEST_CASE("Testing strict json input", "[json_strict_tests]") {
+   point p;
+   // skipped members are checked like decoded ones
+   REQUIRE_THROWS_AS( from_json(R"({"z": [1 2], "x": 1})", p), json_error );
+   REQUIRE_THROWS_AS( from_json(R"({"z": {"a" 1}})", p), json_error );
+   REQUIRE_THROWS_AS( from_json(R"({"z": {1: 2}})", p), json_error );
+   REQUIRE_THROWS_AS( from_json(R"({"z": [1,]})", p), json_error );
+   REQUIRE_THROWS_AS( from_json(R"({"z": ]})", p), json_error );
+   REQUIRE_THROWS_AS( from_json(R"({"z": "\q"})", p), json_error );
+   REQUIRE_THROWS_AS( from_json(R"({"z": 1e})", p), json_error );
+   REQUIRE_THROWS_AS( from_json(R"({"z": --1})", p), json_error );
+   REQUIRE_THROWS_AS( from_json(std::string(600, '[') + std::string(600, ']'), p), json_error );
+   from_json(R"({"z": [{"a": [true, null, -0.5e-3, ""]}], "x": 6})", p);
+   REQUIRE( p.x == 6 );
+
+   // numbers follow the JSON grammar
+   double d = 0;
+   from_json("-1.25E+2", d);
+   REQUIRE( d == -125 );
+   REQUIRE_THROWS_AS( from_json("inf", d), json_error );
+   REQUIRE_THROWS_AS( from_json("nan", d), json_error );
+   REQUIRE_THROWS_AS( from_json("+1", d), json_error );
+   REQUIRE_THROWS_AS( from_json("01", d), json_error );
+   REQUIRE_THROWS_AS( from_json("1.", d), json_error );
+   REQUIRE_THROWS_AS( from_json(".5", d), json_error );
+   int i = 0;
+   REQUIRE_THROWS_AS( from_json("1.5", i), json_error );
+   REQUIRE_THROWS_AS( from_json("1e3", i), json_error );
+   from_json("-0", i);
+   REQUIRE( i == 0 );
+
+   // raw control characters must be escaped
+   std::string str;
+   REQUIRE_THROWS_AS( from_json("\"a\tb\"", str), json_error );
+   REQUIRE_THROWS_AS( from_json("{\"x\n\": 1}", p), json_error );
+   from_json(R"("a\tb")", str);
+   REQUIRE( str == "a\tb" );
+}
@@ -0,0 +1,67 @@
+#include <bluegrass/meta/kernels.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct bar {
+      std::uint64_t id = 0;
+      double price = 0;
+      std::int32_t qty = 0;
+      float weight = 0;
+      META_REFL(id, price, qty, weight);
+   };
+} // ns anonymous
+
+TEST_CASE("Benchmark column kernels against scalar loops", "[kernel_benchmarks]") {
+   constexpr std::size_t rows = 1 << 16;
+   std::vector<bar> aos(rows);
+   meta_soa_vector<bar> soa;
+   soa.reserve(rows);
+   for (std::size_t i=0; i < rows; i++) {
+      aos[i] = {i, (i % 1000) * 0.25, static_cast<std::int32_t>(i % 777) - 300, static_cast<float>(i % 13)};
+      soa.push_back(aos[i]);
+   }
+   const auto& columns = soa;
+
+   BENCHMARK("scalar for_each sum of price (AoS)") {
+      double total = 0;
+      for (const auto& b : aos)
+         meta_object<bar>::for_each(b, [&](const auto& f) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(f)>, double>)
+               total += f;
+         });
+      return total;
+   };
+
+   BENCHMARK("scalar sum of price column") {
+      return detail::scalar_reduce(columns.column<1>(), std::plus<>{});
+   };
+
+   BENCHMARK("reduce<&bar::price> sum") {
+      return reduce<&bar::price>(soa, std::plus<>{});
+   };
+
+   BENCHMARK("scalar max of qty column") {
+      return detail::scalar_reduce(columns.column<2>(), maximum{});
+   };
+
+   BENCHMARK("reduce<&bar::qty> max") {
+      return reduce<&bar::qty>(soa, maximum{});
+   };
+
+   BENCHMARK("scalar filter of qty column") {
+      selection sel{rows};
+      detail::scalar_filter(columns.column<2>(), where::gt(100), sel);
+      return sel.count();
+   };
+
+   BENCHMARK("filter<&bar::qty> gt") {
+      return filter<&bar::qty>(soa, where::gt(100)).count();
+   };
+}
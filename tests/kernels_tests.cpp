@@ -0,0 +1,116 @@
+#include <bluegrass/meta/kernels.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct tick {
+      std::int32_t  qty = 0;
+      double        price = 0;
+      float         weight = 0;
+      std::int64_t  volume = 0;
+      std::uint16_t venue = 0;
+      META_REFL(qty, price, weight, volume, venue);
+   };
+
+   meta_soa_vector<tick> make_ticks(std::size_t n) {
+      meta_soa_vector<tick> ticks;
+      for (std::size_t i=0; i < n; i++) {
+         const auto v = static_cast<std::int32_t>((i * 37) % 101) - 50;
+         ticks.push_back({v, v * 0.5, static_cast<float>(v), v * 1000000000LL, static_cast<std::uint16_t>(i % 7)});
+      }
+      return ticks;
+   }
+} // ns anonymous
+
+TEST_CASE("Testing field index lookup", "[field_index_tests]") {
+   static_assert( field_index_v<&tick::qty> == 0 );
+   static_assert( field_index_v<&tick::weight> == 2 );
+   static_assert( field_index_v<&tick::venue> == 4 );
+}
+
+TEST_CASE("Testing column reductions", "[kernel_reduce_tests]") {
+   // odd size to exercise the scalar tail
+   auto ticks = make_ticks(1003);
+   std::int64_t qty_sum = 0;
+   std::int32_t qty_min = 1000, qty_max = -1000;
+   std::uint64_t venue_sum = 0;
+   for (auto q : ticks.column<0>()) {
+      qty_sum += q;
+      qty_min = std::min(qty_min, q);
+      qty_max = std::max(qty_max, q);
+   }
+   for (auto v : ticks.column<4>())
+      venue_sum += v;
+
+   REQUIRE( reduce<&tick::qty>(ticks, std::plus<>{}) == qty_sum );
+   REQUIRE( reduce<0>(ticks, minimum{}) == qty_min );
+   REQUIRE( reduce<0>(ticks, maximum{}) == qty_max );
+   REQUIRE( reduce<&tick::price>(ticks, std::plus<>{}) == Approx(qty_sum * 0.5) );
+   REQUIRE( reduce<&tick::price>(ticks, minimum{}) == qty_min * 0.5 );
+   REQUIRE( reduce<&tick::weight>(ticks, maximum{}) == static_cast<float>(qty_max) );
+   REQUIRE( reduce<&tick::volume>(ticks, std::plus<>{}) == qty_sum * 1000000000LL );
+   REQUIRE( reduce<&tick::volume>(ticks, minimum{}) == qty_min * 1000000000LL );
+   // scalar only paths
+   REQUIRE( reduce<&tick::venue>(ticks, [](auto a, auto b) { return static_cast<std::uint16_t>(a + b); }) ==
+            static_cast<std::uint16_t>(venue_sum) );
+
+   meta_soa_vector<tick> empty;
+   REQUIRE( reduce<&tick::qty>(empty, std::plus<>{}) == 0 );
+}
+
+TEST_CASE("Testing floating point reduction edge cases", "[kernel_float_reduce_tests]") {
+   constexpr double inf = std::numeric_limits<double>::infinity();
+   constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+   const std::vector<double> pos_inf(9, inf);
+   const std::vector<double> neg_inf(9, -inf);
+   REQUIRE( reduce(span<const double>{pos_inf}, minimum{}) == inf );
+   REQUIRE( reduce(span<const double>{neg_inf}, maximum{}) == -inf );
+   REQUIRE( reduce(span<const float>{}, minimum{}) == std::numeric_limits<float>::infinity() );
+
+   // NaN is skipped wherever it is, in a vector lane or the scalar tail, as by detail::scalar_reduce
+   std::vector<double> values = {nan, 3, -2, nan, 7, 1, nan, 5, nan};
+   for (std::size_t i=0; i < values.size(); i++) {
+      std::rotate(values.begin(), values.begin() + 1, values.end());
+      const span<const double> col{values};
+      REQUIRE( reduce(col, minimum{}) == -2 );
+      REQUIRE( reduce(col, maximum{}) == 7 );
+      REQUIRE( reduce(col, minimum{}) == detail::scalar_reduce(col, minimum{}) );
+   }
+   const std::vector<float> nans(8, std::numeric_limits<float>::quiet_NaN());
+   REQUIRE( reduce(span<const float>{nans}, maximum{}) == -std::numeric_limits<float>::infinity() );
+}
+
+TEST_CASE("Testing column filters", "[kernel_filter_tests]") {
+   auto ticks = make_ticks(517);
+   const auto qty = ticks.column<0>();
+
+   const auto check = [&](const selection& sel, auto&& pred) {
+      REQUIRE( sel.size() == qty.size() );
+      std::size_t expected = 0;
+      for (std::size_t i=0; i < qty.size(); i++) {
+         REQUIRE( sel.test(i) == pred(qty[i]) );
+         expected += pred(qty[i]);
+      }
+      REQUIRE( sel.count() == expected );
+   };
+
+   check(filter<&tick::qty>(ticks, where::lt(7)), [](auto v) { return v < 7; });
+   check(filter<&tick::qty>(ticks, where::le(7)), [](auto v) { return v <= 7; });
+   check(filter<&tick::qty>(ticks, where::gt(-3)), [](auto v) { return v > -3; });
+   check(filter<&tick::qty>(ticks, where::ge(-3)), [](auto v) { return v >= -3; });
+   check(filter<&tick::qty>(ticks, where::eq(0)), [](auto v) { return v == 0; });
+   check(filter<&tick::qty>(ticks, where::ne(0)), [](auto v) { return v != 0; });
+   check(filter<&tick::price>(ticks, where::gt(10.0)), [](auto v) { return v * 0.5 > 10.0; });
+   check(filter<&tick::weight>(ticks, where::le(-4.0f)), [](auto v) { return v <= -4; });
+   check(filter<&tick::volume>(ticks, where::ge(std::int64_t{0})), [](auto v) { return v >= 0; });
+   check(filter<0>(ticks, [](auto v) { return v % 3 == 0; }), [](auto v) { return v % 3 == 0; });
+}
@@ -0,0 +1,96 @@
+#include <bluegrass/meta/lazy.hpp>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct header {
+      std::uint32_t route = 0;
+      std::uint16_t flags = 0;
+      META_REFL(route, flags);
+   };
+
+   struct point {
+      std::int32_t x = 0;
+      std::int32_t y = 0;
+      META_REFL(x, y);
+   };
+
+   struct message : header {
+      using super_t = header;
+      std::string                      topic;
+      std::vector<std::string>         lines;
+      std::vector<point>               points;
+      std::tuple<std::uint8_t, std::string> tag;
+      std::array<std::string, 2>       pair;
+      std::uint64_t                    trailer = 0;
+      META_REFL(topic, lines, points, tag, pair, trailer);
+   };
+
+   message make_message() {
+      message m;
+      m.route   = 17;
+      m.flags   = 3;
+      m.topic   = "orders";
+      m.lines   = {"one", "two", "three"};
+      m.points  = {{1, 2}, {3, 4}};
+      m.tag     = {9, "nine"};
+      m.pair    = {"left", "right"};
+      m.trailer = 0xFEEDFACE;
+      return m;
+   }
+} // ns anonymous
+
+TEST_CASE("Testing lazy_object field access", "[lazy_tests]") {
+   const message m = make_message();
+   std::vector<std::byte> buf(serialized_size(m) + 5);
+   const std::size_t size = serialize(m, buf);
+
+   lazy_object<message> lazy{buf};
+   REQUIRE( lazy.size() == size );
+   REQUIRE( lazy.bytes().size() == size );
+   REQUIRE( !lazy.decoded<0>() );
+
+   // base class fields come first, as in meta_hierarchy
+   REQUIRE( lazy.get<0>() == 17 );
+   REQUIRE( lazy.get<1>() == 3 );
+   REQUIRE( lazy.decoded<0>() );
+   REQUIRE( !lazy.decoded<2>() );
+   REQUIRE( !lazy.decoded<7>() );
+
+   REQUIRE( lazy.get<7>() == 0xFEEDFACE );
+   REQUIRE( lazy.get<2>() == "orders" );
+   REQUIRE( &lazy.get<2>() == &lazy.get<2>() );
+   REQUIRE( !lazy.decoded<3>() );
+
+   // undecoded fields can be forwarded as they are
+   const auto lines = lazy.raw<3>();
+   std::vector<std::string> decoded_lines;
+   REQUIRE( deserialize(decoded_lines, lines) == lines.size() );
+   REQUIRE( decoded_lines == m.lines );
+   REQUIRE( lazy.raw<0>().size() == sizeof(std::uint32_t) );
+   REQUIRE( lazy.raw<5>().size() == 1 + 4 + 4 );
+
+   const message& all = lazy.value();
+   REQUIRE( all.lines == m.lines );
+   REQUIRE( all.points[1].y == 4 );
+   REQUIRE( all.tag == m.tag );
+   REQUIRE( all.pair == m.pair );
+   REQUIRE( lazy.decoded<6>() );
+}
+
+TEST_CASE("Testing lazy_object on a short buffer", "[lazy_error_tests]") {
+   const message m = make_message();
+   std::vector<std::byte> buf(serialized_size(m));
+   serialize(m, buf);
+   REQUIRE_THROWS_AS( lazy_object<message>(span<const std::byte>{buf.data(), buf.size() - 1}), std::out_of_range );
+}
@@ -0,0 +1,71 @@
+#include <bluegrass/meta/lookup.hpp>
+
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct config {
+      int threads = 0;
+      double ratio = 0;
+      std::string name;
+      bool verbose = false;
+      META_REFL(threads, ratio, name, verbose);
+   };
+
+   struct wide {
+      int f00, f01, f02, f03, f04, f05, f06, f07, f08, f09;
+      int f10, f11, f12, f13, f14, f15, f16, f17, f18, f19;
+      int f20, f21, f22, f23, f24, f25, f26, f27, f28, f29;
+      META_REFL(f00, f01, f02, f03, f04, f05, f06, f07, f08, f09,
+                f10, f11, f12, f13, f14, f15, f16, f17, f18, f19,
+                f20, f21, f22, f23, f24, f25, f26, f27, f28, f29);
+   };
+} // ns anonymous
+
+TEST_CASE("Testing perfect hash field lookup", "[lookup_find_tests]") {
+   static_assert( find_field<config>("threads") == 0 );
+   static_assert( find_field<config>("verbose") == 3 );
+   static_assert( find_field<config>("missing") == field_npos );
+
+   REQUIRE( find_field<config>(std::string("ratio")) == 1 );
+   REQUIRE( find_field<config>("") == field_npos );
+   REQUIRE( find_field<config>("nam") == field_npos );
+
+   constexpr auto names = meta_object<wide>::names;
+   for (std::size_t i=0; i < names.size(); i++)
+      REQUIRE( find_field<wide>(names[i]) == i );
+   REQUIRE( find_field<wide>("f30") == field_npos );
+
+   constexpr perfect_hash<0> empty{std::array<std::string_view, 0>{}};
+   REQUIRE( empty.find("a") == field_npos );
+
+   // a repeated name can never be placed, the search stops instead of running into the constexpr limit
+   constexpr perfect_hash<3> repeated{std::array<std::string_view, 3>{"a", "b", "a"}};
+   static_assert( !repeated.complete );
+   static_assert( field_hash_v<config>.complete );
+}
+
+TEST_CASE("Testing visit_field", "[lookup_visit_tests]") {
+   config c;
+   REQUIRE( visit_field(c, "ratio", [](auto& v) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(v)>, double>)
+         v = 0.75;
+   }) );
+   REQUIRE( c.ratio == 0.75 );
+
+   REQUIRE( visit_field(c, "name", [](auto& v) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::string>)
+         v = "worker";
+   }) );
+   REQUIRE( c.name == "worker" );
+   REQUIRE( !visit_field(c, "unknown", [](auto&) { FAIL("visited an unknown field"); }) );
+
+   const config& cc = c;
+   bool is_const = false;
+   REQUIRE( visit_field(cc, "threads", [&](auto& v) { is_const = std::is_const_v<std::remove_reference_t<decltype(v)>>; }) );
+   REQUIRE( is_const );
+}
@@ -1,5 +1,7 @@
 #include <bluegrass/meta/refl.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <string>
 
@@ -42,6 +44,88 @@ struct test_struct3 : test_struct2 {
    META_REFL(s);
 };
 
+struct literal_struct {
+   int a = 0;
+   double b = 0;
+   char c = 0;
+   META_REFL(a, b, c);
+};
+
+struct packed_struct {
+   std::uint32_t a = 0;
+   std::uint32_t b = 0;
+   std::uint64_t c = 0;
+   META_REFL(a, b, c);
+};
+
+struct hidden_struct {
+   std::uint64_t a = 0;
+   std::uint64_t hidden = 0;
+   std::uint32_t b = 0;
+   META_REFL(a, b);
+};
+
+struct array_struct {
+   std::uint8_t  tag = 0;
+   std::uint16_t ids[3] = {};
+   META_REFL(tag, ids);
+};
+
+struct wide_struct {
+   int f000, f001, f002, f003, f004, f005, f006, f007, f008, f009, f010, f011, f012, f013, f014, f015;
+   int f016, f017, f018, f019, f020, f021, f022, f023, f024, f025, f026, f027, f028, f029, f030, f031;
+   int f032, f033, f034, f035, f036, f037, f038, f039, f040, f041, f042, f043, f044, f045, f046, f047;
+   int f048, f049, f050, f051, f052, f053, f054, f055, f056, f057, f058, f059, f060, f061, f062, f063;
+   int f064, f065, f066, f067, f068, f069, f070, f071, f072, f073, f074, f075, f076, f077, f078, f079;
+   int f080, f081, f082, f083, f084, f085, f086, f087, f088, f089, f090, f091, f092, f093, f094, f095;
+   int f096, f097, f098, f099, f100, f101, f102, f103, f104, f105, f106, f107, f108, f109, f110, f111;
+   int f112, f113, f114, f115, f116, f117, f118, f119, f120, f121, f122, f123, f124, f125, f126, f127;
+   META_REFL(f000, f001, f002, f003, f004, f005, f006, f007, f008, f009, f010, f011, f012, f013, f014, f015,
+             f016, f017, f018, f019, f020, f021, f022, f023, f024, f025, f026, f027, f028, f029, f030, f031,
+             f032, f033, f034, f035, f036, f037, f038, f039, f040, f041, f042, f043, f044, f045, f046, f047,
+             f048, f049, f050, f051, f052, f053, f054, f055, f056, f057, f058, f059, f060, f061, f062, f063,
+             f064, f065, f066, f067, f068, f069, f070, f071, f072, f073, f074, f075, f076, f077, f078, f079,
+             f080, f081, f082, f083, f084, f085, f086, f087, f088, f089, f090, f091, f092, f093, f094, f095,
+             f096, f097, f098, f099, f100, f101, f102, f103, f104, f105, f106, f107, f108, f109, f110, f111,
+             f112, f113, f114, f115, f116, f117, f118, f119, f120, f121, f122, f123, f124, f125, f126, f127);
+};
+
+struct left_base {
+   std::uint32_t l0 = 0;
+   double        l1 = 0;
+   META_REFL(l0, l1);
+};
+
+struct right_base {
+   std::string   r0;
+   std::uint32_t r1 = 0;
+   META_REFL(r0, r1);
+};
+
+struct multi_struct : left_base, right_base {
+   using super_t = base_types_t<left_base, right_base>;
+   std::uint32_t d0 = 0;
+   META_REFL(d0);
+};
+
+struct packed_base {
+   std::uint32_t a = 0;
+   std::uint32_t b = 0;
+   META_REFL(a, b);
+};
+
+struct packed_derived : packed_base {
+   using super_t = packed_base;
+   std::uint32_t c = 0;
+   std::uint32_t d = 0;
+   META_REFL(c, d);
+};
+
+template <typename T, typename F>
+std::ptrdiff_t offset_of(const T& t, const F& f) {
+   return reinterpret_cast<const char*>(&f) - reinterpret_cast<const char*>(&t);
+}
+
 void update(int& i) { i += 20; }
 void update(float& f) { f += 20; }
 void update(std::string& s) { s += " Hello"; }
@@ -61,6 +145,11 @@ TEST_CASE("Testing basic meta object", "[basic_meta_tests]") {
    test_struct3 ss3 = { 42, 32.24f, "hello", 1001, "world" };
    ts3_meta::for_each_full(ss3, [](const auto& v) { std::cout << v << " " << std::endl; });
 
+   const test_struct3& css3 = ss3;
+   std::size_t visited = 0;
+   ts3_meta::for_each_full(css3, [&](const auto&) { visited++; });
+   REQUIRE( visited == 5 );
+
    // !!! the require macro throws off the evaluation of
    // this and it will produce the wrong result because
    // of preprocessor voodoo
@@ -99,6 +188,95 @@ TEST_CASE("Testing basic meta object", "[basic_meta_tests]") {
    REQUIRE( ts.c == "fello Hello" );
 }
 
+TEST_CASE("Testing constexpr field access", "[constexpr_get_tests]") {
+   using ls_meta = meta_object<literal_struct>;
+
+   constexpr literal_struct ls = {13, 4.2, 'x'};
+   static_assert( ls_meta::get<0>(ls) == 13 );
+   static_assert( ls_meta::get<1>(ls) == 4.2 );
+   static_assert( ls_meta::get<2>(ls) == 'x' );
+
+   REQUIRE( std::is_same_v<decltype(ls_meta::get<1>(ls)), const double&> );
+   REQUIRE( std::is_same_v<std::tuple_element_t<0, std::decay_t<decltype(ls_meta::field_ptrs)>>, int literal_struct::*> );
+   REQUIRE( &ls_meta::get<2>(ls) == &ls.c );
+
+   using ts2_meta = meta_object<test_struct2>;
+   test_struct2 ts2 = { 42, 32.32f, "hello", 1001 };
+   REQUIRE( &ts2_meta::get<0>(ts2) == &ts2.a );
+   REQUIRE( ts2_meta::get<0>(ts2) == 1001 );
+}
+
+TEST_CASE("Testing meta object layout", "[layout_meta_tests]") {
+   using ls_meta = meta_object<literal_struct>;
+   constexpr auto layout = ls_meta::layout;
+   static_assert( layout.size() == 3 );
+   static_assert( layout[0].offset == offsetof(literal_struct, a) );
+   static_assert( layout[1].offset == offsetof(literal_struct, b) );
+   static_assert( layout[2].offset == offsetof(literal_struct, c) );
+   REQUIRE( layout[0].size == sizeof(int) );
+   REQUIRE( layout[1].size == sizeof(double) );
+   REQUIRE( layout[1].alignment == alignof(double) );
+   REQUIRE( layout[2].trivially_copyable );
+   REQUIRE( ls_meta::field_bytes == sizeof(int) + sizeof(double) + sizeof(char) );
+   // every member is reflected, so everything that isn't a field is padding
+   REQUIRE( ls_meta::padding == sizeof(literal_struct) - ls_meta::field_bytes );
+   REQUIRE( ls_meta::unreflected_bytes == ls_meta::padding );
+
+   // `a` is followed by padding so it can't be merged with `b`
+   REQUIRE( ls_meta::trivial_runs.size() == 2 );
+   REQUIRE( ls_meta::trivial_runs[0].first == 0 );
+   REQUIRE( ls_meta::trivial_runs[0].count == 1 );
+   REQUIRE( ls_meta::trivial_runs[1].first == 1 );
+   REQUIRE( ls_meta::trivial_runs[1].count == 2 );
+   REQUIRE( ls_meta::trivial_runs[1].size == sizeof(double) + sizeof(char) );
+
+   using ps_meta = meta_object<packed_struct>;
+   REQUIRE( ps_meta::padding == 0 );
+   REQUIRE( ps_meta::unreflected_bytes == 0 );
+   REQUIRE( ps_meta::trivial_runs.size() == 1 );
+   REQUIRE( ps_meta::trivial_runs[0].count == 3 );
+   REQUIRE( ps_meta::trivial_runs[0].size == sizeof(packed_struct) );
+
+   // the unreflected member isn't padding, only the tail after `b` is
+   using hs_meta = meta_object<hidden_struct>;
+   static_assert( hs_meta::padding == sizeof(hidden_struct) - offsetof(hidden_struct, b) - sizeof(std::uint32_t) );
+   static_assert( hs_meta::unreflected_bytes == hs_meta::padding + sizeof(std::uint64_t) );
+
+   // C arrays are laid out with their declared type, not the decayed pointer
+   using as_meta = meta_object<array_struct>;
+   static_assert( std::is_same_v<as_meta::field_type<1>, std::uint16_t[3]> );
+   static_assert( as_meta::layout[1].size == sizeof(std::uint16_t[3]) );
+   static_assert( as_meta::layout[1].alignment == alignof(std::uint16_t) );
+   static_assert( as_meta::field_bytes == 1 + 6 );
+   static_assert( as_meta::padding == sizeof(array_struct) - as_meta::field_bytes );
+
+   using ts_meta = meta_object<test_struct>;
+   REQUIRE( !ts_meta::layout[2].trivially_copyable );
+   REQUIRE( ts_meta::trivial_runs.size() == 1 );
+   REQUIRE( ts_meta::trivial_runs[0].count == 2 );
+
+   using ts3_meta = meta_object<test_struct3>;
+   REQUIRE( ts3_meta::field_bytes == ts_meta::field_bytes + sizeof(int) + sizeof(std::string) );
+   test_struct3 ts3 = { 42, 32.24f, "hello", 1001, "world" };
+   const auto s_offset = reinterpret_cast<const char*>(&ts3.s) - reinterpret_cast<const char*>(&ts3);
+   REQUIRE( ts3_meta::layout[0].offset == static_cast<std::size_t>(s_offset) );
+}
+
+TEST_CASE("Testing meta object with 128 fields", "[wide_meta_tests]") {
+   using ws_meta = meta_object<wide_struct>;
+   REQUIRE( ws_meta::cardinality == 128 );
+   REQUIRE( ws_meta::names[0] == "f000" );
+   REQUIRE( ws_meta::names[127] == "f127" );
+   REQUIRE( ws_meta::layout[127].offset == offsetof(wide_struct, f127) );
+
+   wide_struct ws = {};
+   int i = 0;
+   ws_meta::for_each(ws, [&](int& f) { f = i++; });
+   REQUIRE( ws.f000 == 0 );
+   REQUIRE( ws.f064 == 64 );
+   REQUIRE( ws_meta::get<127>(ws) == 127 );
+}
+
 TEST_CASE("Testing tuple meta object", "[tuple_meta_tests]") {
    using tup_0 = std::tuple<int, float, std::string>;
    using meta_0 = meta_object<tup_0>;
@@ -139,3 +317,63 @@ TEST_CASE("Testing tuple meta object", "[tuple_meta_tests]") {
 
    REQUIRE( i == 60 );
 }
+
+TEST_CASE("Testing flattened hierarchy", "[hierarchy_meta_tests]") {
+   using h3 = meta_hierarchy<test_struct3>;
+   static_assert( h3::cardinality == 5 );
+   static_assert( std::is_same_v<h3::class_of<0>, test_struct> );
+   static_assert( std::is_same_v<h3::class_of<3>, test_struct2> );
+   static_assert( std::is_same_v<h3::type<4>, std::string> );
+   static_assert( std::is_same_v<std::tuple_element_t<0, std::decay_t<decltype(h3::field_ptrs)>>, int test_struct3::*> );
+   REQUIRE( h3::names[0] == "a" );
+   REQUIRE( h3::names[3] == "a" );
+   REQUIRE( h3::names[4] == "s" );
+
+   // test_struct2::a hides test_struct::a, both are reached without a cast
+   test_struct3 ts3 = { 42, 32.24f, "hello", 1001, "world" };
+   REQUIRE( &h3::get<0>(ts3) == &ts3.test_struct::a );
+   REQUIRE( &h3::get<3>(ts3) == &ts3.test_struct2::a );
+   REQUIRE( h3::layout[0].offset == static_cast<std::size_t>(offset_of(ts3, ts3.test_struct::a)) );
+   REQUIRE( h3::layout[3].offset == static_cast<std::size_t>(offset_of(ts3, ts3.test_struct2::a)) );
+   REQUIRE( h3::layout[4].offset == static_cast<std::size_t>(offset_of(ts3, ts3.s)) );
+
+   // runs are computed over the flattened layout so they may span classes
+   using hp = meta_hierarchy<packed_derived>;
+   REQUIRE( hp::trivial_runs.size() == 1 );
+   REQUIRE( hp::trivial_runs[0].count == 4 );
+   REQUIRE( hp::trivial_runs[0].size == sizeof(packed_derived) );
+   // padding is taken over the whole hierarchy, the base's fields fill the derived object
+   static_assert( meta_object<packed_derived>::padding == 0 );
+}
+
+TEST_CASE("Testing multiple inheritance through base_types_t", "[multi_base_meta_tests]") {
+   using mo = meta_object<multi_struct>;
+   using hm = meta_hierarchy<multi_struct>;
+   static_assert( std::is_same_v<mo::bases, std::tuple<left_base, right_base>> );
+   static_assert( std::is_same_v<meta_object<left_base>::bases, std::tuple<>> );
+   static_assert( hm::cardinality == 5 );
+   static_assert( std::is_same_v<hm::class_of<2>, right_base> );
+   static_assert( mo::field_bytes == 4 + 8 + sizeof(std::string) + 4 + 4 );
+   REQUIRE( hm::names == std::array<std::string_view, 5>{"l0", "l1", "r0", "r1", "d0"} );
+
+   multi_struct m;
+   m.l0 = 1;
+   m.l1 = 2.5;
+   m.r0 = "three";
+   m.r1 = 4;
+   m.d0 = 5;
+   REQUIRE( hm::layout[0].offset == static_cast<std::size_t>(offset_of(m, m.l0)) );
+   REQUIRE( hm::layout[2].offset == static_cast<std::size_t>(offset_of(m, m.r0)) );
+   REQUIRE( hm::layout[3].offset == static_cast<std::size_t>(offset_of(m, m.r1)) );
+   REQUIRE( hm::layout[4].offset == static_cast<std::size_t>(offset_of(m, m.d0)) );
+   REQUIRE( hm::get<2>(m) == "three" );
+
+   std::string seen;
+   mo::for_each_full(m, [&](const auto& v) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::string>)
+         seen += v;
+      else
+         seen += std::to_string(static_cast<int>(v));
+   });
+   REQUIRE( seen == "12three45" );
+}
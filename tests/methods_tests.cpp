@@ -0,0 +1,70 @@
+#include <bluegrass/meta/methods.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct counter {
+      std::int64_t value = 0;
+      std::string  log;
+
+      void add(std::int64_t v) { value += v; }
+      void reset() { value = 0; }
+      std::int64_t get() const { return value; }
+      std::size_t note(std::string_view s) {
+         log += s;
+         return log.size();
+      }
+
+      META_REFL(value, log);
+      META_REFL_METHODS(add, reset, get, note);
+   };
+} // ns anonymous
+
+TEST_CASE("Testing method reflection", "[methods_tests]") {
+   using mm = meta_methods<counter>;
+   static_assert( mm::cardinality == 4 );
+   static_assert( std::is_same_v<mm::method_type<2>, std::int64_t (counter::*)() const> );
+   REQUIRE( mm::names[0] == "add" );
+   REQUIRE( mm::names[3] == "note" );
+   REQUIRE( find_method<counter>("get") == 2 );
+   REQUIRE( find_method<counter>("missing") == field_npos );
+}
+
+TEST_CASE("Testing method invocation", "[methods_invoke_tests]") {
+   using meta_t = meta_object<counter>;
+   counter c;
+
+   // compile time index, the result type is the method's own
+   meta_t::invoke<0>(c, 5);
+   REQUIRE( meta_t::invoke<2>(c) == 5 );
+
+   // runtime index and name through the jump table
+   meta_t::invoke(c, std::size_t{0}, 10);
+   REQUIRE( c.value == 15 );
+   meta_t::invoke(c, "add", std::int64_t{-3});
+   REQUIRE( meta_t::invoke<std::int64_t>(c, "get") == 12 );
+   REQUIRE( meta_t::invoke<std::size_t>(c, "note", std::string_view{"abc"}) == 3 );
+   // the result may be discarded
+   meta_t::invoke(c, "note", "de");
+   REQUIRE( c.log == "abcde" );
+
+   const counter& cc = c;
+   REQUIRE( meta_t::invoke<std::int64_t>(cc, "get") == 12 );
+   // non const method on a const object
+   REQUIRE_THROWS_AS( meta_t::invoke(cc, "reset"), std::invalid_argument );
+   // wrong arguments
+   REQUIRE_THROWS_AS( meta_t::invoke(c, "add"), std::invalid_argument );
+   REQUIRE_THROWS_AS( meta_t::invoke(c, "missing"), std::out_of_range );
+   REQUIRE_THROWS_AS( meta_t::invoke(c, std::size_t{4}), std::out_of_range );
+
+   meta_t::invoke(c, "reset");
+   REQUIRE( c.value == 0 );
+}
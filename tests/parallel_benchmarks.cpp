@@ -0,0 +1,51 @@
+#include <bluegrass/meta/parallel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct sample {
+      double        value = 0;
+      float         gain  = 0;
+      std::int64_t  ts    = 0;
+      std::string   tag;
+      META_REFL(value, gain, ts, tag);
+   };
+
+   struct normalize {
+      void operator()(double& d) const { d = std::clamp(std::sqrt(d * 1.5 + 1), 0.0, 1000.0); }
+      void operator()(float& f) const { f = std::clamp(f * 0.5f, -1.0f, 1.0f); }
+      void operator()(std::int64_t& ts) const { ts = ts / 1000 * 1000; }
+      void operator()(std::string& s) const {
+         s.erase(0, s.find_first_not_of(' '));
+         s.erase(s.find_last_not_of(' ') + 1);
+      }
+   };
+} // ns anonymous
+
+TEST_CASE("Benchmark parallel_for_each_batch scaling", "[parallel_benchmarks]") {
+   std::vector<sample> rows(1 << 20);
+   for (std::size_t i=0; i < rows.size(); i++)
+      rows[i] = {static_cast<double>(i), static_cast<float>(i % 7), static_cast<std::int64_t>(i * 37), " tag "};
+
+   BENCHMARK("for_each_batch") {
+      meta_object<sample>::for_each_batch(rows, normalize{});
+      return rows.front().value;
+   };
+
+   const std::size_t max_workers = std::max<std::size_t>(4, default_workers());
+   for (std::size_t workers=1; workers <= max_workers; workers *= 2) {
+      BENCHMARK("parallel_for_each_batch " + std::to_string(workers) + " workers") {
+         parallel_for_each_batch(rows, normalize{}, workers);
+         return rows.front().value;
+      };
+   }
+}
@@ -0,0 +1,118 @@
+#include <bluegrass/meta/parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct reading {
+      double        celsius = 0;
+      std::int32_t  level   = 0;
+      std::string   label;
+      META_REFL(celsius, level, label);
+   };
+
+   struct normalize {
+      void operator()(double& d) const { d = d * 9 / 5 + 32; }
+      void operator()(std::int32_t& i) const { i = std::clamp(i, 0, 100); }
+      void operator()(std::string& s) const {
+         s.erase(0, s.find_first_not_of(' '));
+         s.erase(s.find_last_not_of(' ') + 1);
+      }
+   };
+
+   std::vector<reading> make_readings(std::size_t n) {
+      std::vector<reading> rs(n);
+      for (std::size_t i=0; i < n; i++)
+         rs[i] = {static_cast<double>(i % 50), static_cast<std::int32_t>(i % 300) - 100, "  r" + std::to_string(i % 10) + " "};
+      return rs;
+   }
+} // ns anonymous
+
+TEST_CASE("Testing for_each_batch", "[for_each_batch_tests]") {
+   auto rs = make_readings(10);
+   meta_object<reading>::for_each_batch(rs, normalize{});
+   REQUIRE( rs[5].celsius == 41.0 );
+   REQUIRE( rs[5].level == 0 );
+   REQUIRE( rs[5].label == "r5" );
+
+   auto tuples = std::vector<std::tuple<int, int>>{{1, 2}, {3, 4}};
+   meta_object<std::tuple<int, int>>::for_each_batch(tuples, [](int& i) { i *= 10; });
+   REQUIRE( tuples[1] == std::make_tuple(30, 40) );
+}
+
+TEST_CASE("Testing parallel_for_each_batch", "[parallel_for_each_batch_tests]") {
+   const auto expected = [](){
+      auto rs = make_readings(50000);
+      meta_object<reading>::for_each_batch(rs, normalize{});
+      return rs;
+   }();
+
+   for (std::size_t workers : {1, 2, 4, 7}) {
+      auto rs = make_readings(50000);
+      parallel_for_each_batch(rs, normalize{}, workers, 333);
+      for (std::size_t i=0; i < rs.size(); i++) {
+         REQUIRE( rs[i].celsius == expected[i].celsius );
+         REQUIRE( rs[i].level == expected[i].level );
+         REQUIRE( rs[i].label == expected[i].label );
+      }
+   }
+
+   // every field is visited exactly once, also through a span over part of the data
+   auto rs = make_readings(10000);
+   std::atomic<std::size_t> visited{0};
+   parallel_for_each_batch(span<reading>(rs.data() + 100, 5000), [&](auto&) { visited++; }, 3, 64);
+   REQUIRE( visited == 3 * 5000 );
+
+   std::vector<reading> empty;
+   parallel_for_each_batch(empty, normalize{}, 4);
+
+   REQUIRE_THROWS_AS( parallel_for_each_batch(rs, [](auto& f) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(f)>, std::int32_t>)
+         if (f == 150)
+            throw std::runtime_error("bad level");
+   }, 4, 100), std::runtime_error );
+}
+
+TEST_CASE("Testing the parallel worker pool", "[parallel_pool_tests]") {
+   // threads are kept and reused, so repeated calls neither grow the pool nor see threads outside of it
+   auto warm = make_readings(4000);
+   parallel_for_each_batch(warm, [](auto&) {}, 3, 16);
+   const std::size_t pool_size = detail::worker_pool::instance().size();
+   REQUIRE( pool_size >= 2 );
+
+   std::set<std::thread::id> ids;
+   std::mutex ids_mtx;
+   for (int round=0; round < 20; round++) {
+      auto rs = make_readings(4000);
+      parallel_for_each_batch(rs, [&](auto&) {
+         std::lock_guard<std::mutex> lock(ids_mtx);
+         ids.insert(std::this_thread::get_id());
+      }, 3, 16);
+   }
+   REQUIRE( detail::worker_pool::instance().size() == pool_size );
+   REQUIRE( ids.size() <= pool_size + 1 );
+
+   // a visitor may itself run a parallel batch, it runs on the thread of the visitor
+   auto outer = make_readings(64);
+   std::atomic<std::size_t> inner_visited{0};
+   parallel_for_each_batch(outer, [&](auto& f) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(f)>, std::int32_t>) {
+         auto inner = make_readings(8);
+         parallel_for_each_batch(inner, [&](auto&) { inner_visited++; }, 2, 1);
+      }
+   }, 4, 4);
+   REQUIRE( inner_visited == 64 * 8 * 3 );
+}
@@ -0,0 +1,107 @@
+#include <bluegrass/meta/patch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct position {
+      double x = 0;
+      double y = 0;
+      META_REFL(x, y);
+   };
+
+   struct entity {
+      std::uint64_t id = 0;
+      position      pos;
+      std::string   name;
+      std::uint32_t hp = 0;
+      META_REFL(id, pos, name, hp);
+   };
+
+   struct player : entity {
+      using super_t = entity;
+      std::vector<std::uint32_t> items;
+      float speed = 0;
+      std::uint8_t level = 0;
+      std::int16_t a = 0, b = 0, c = 0, d = 0;
+      META_REFL(items, speed, level, a, b, c, d);
+   };
+} // ns anonymous
+
+TEST_CASE("Testing diff and apply", "[patch_tests]") {
+   entity old{1, {1.0, 2.0}, "orc", 100};
+   entity now = old;
+
+   auto patch = diff(old, now);
+   REQUIRE( patch.size() == 1 );
+   REQUIRE( changed_fields<entity>(patch) == 0 );
+
+   now.hp = 90;
+   patch = diff(old, now);
+   REQUIRE( patch.size() == 1 + sizeof(std::uint32_t) );
+   REQUIRE( changed_fields<entity>(patch) == 1 );
+   REQUIRE( std::to_integer<int>(patch[0]) == 0b1000 );
+
+   now.name = "orc chief";
+   now.pos.y = 3.0;
+   patch = diff(old, now);
+   REQUIRE( changed_fields<entity>(patch) == 3 );
+
+   entity target = old;
+   REQUIRE( meta::apply(target, patch) == patch.size() );
+   REQUIRE( target.id == 1 );
+   REQUIRE( target.pos.x == 1.0 );
+   REQUIRE( target.pos.y == 3.0 );
+   REQUIRE( target.name == "orc chief" );
+   REQUIRE( target.hp == 90 );
+
+   std::vector<std::byte> buf(64);
+   REQUIRE( diff(old, now, buf) == patch.size() );
+   REQUIRE( std::vector<std::byte>(buf.begin(), buf.begin() + patch.size()) == patch );
+
+   std::vector<std::byte> small(2);
+   REQUIRE_THROWS_AS( diff(old, now, small), std::out_of_range );
+   REQUIRE_THROWS_AS( meta::apply(target, span<const std::byte>(patch.data(), 3)), std::out_of_range );
+
+   // a truncated patch leaves the object as it was, even the fields that precede the cut
+   entity untouched = old;
+   REQUIRE_THROWS_AS( meta::apply(untouched, span<const std::byte>(patch.data(), patch.size() - 1)), std::out_of_range );
+   REQUIRE( untouched.pos.y == 2.0 );
+   REQUIRE( untouched.name == "orc" );
+   REQUIRE( untouched.hp == 100 );
+}
+
+TEST_CASE("Testing diff and apply over a hierarchy", "[patch_hierarchy_tests]") {
+   player old;
+   old.id = 7;
+   old.name = "hero";
+   old.items = {1, 2, 3};
+   player now = old;
+
+   // 4 fields of entity and 7 of player
+   REQUIRE( diff(old, now).size() == 2 );
+
+   now.hp = 5;
+   now.items.push_back(4);
+   now.d = -1;
+   const auto patch = diff(old, now);
+   REQUIRE( patch.size() == 2 + sizeof(std::uint32_t) + sizeof(length_prefix_t) + 4 * sizeof(std::uint32_t) + sizeof(std::int16_t) );
+   REQUIRE( changed_fields<player>(patch) == 3 );
+   REQUIRE( std::to_integer<int>(patch[0]) == 0b0001'1000 );
+   REQUIRE( std::to_integer<int>(patch[1]) == 0b0000'0100 );
+
+   player target = old;
+   target.speed = 2.5f; // untouched by the patch
+   REQUIRE( meta::apply(target, patch) == patch.size() );
+   REQUIRE( target.hp == 5 );
+   REQUIRE( target.items == std::vector<std::uint32_t>{1, 2, 3, 4} );
+   REQUIRE( target.d == -1 );
+   REQUIRE( target.speed == 2.5f );
+   REQUIRE( target.name == "hero" );
+}
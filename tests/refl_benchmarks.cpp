@@ -0,0 +1,290 @@
+#include <bluegrass/meta/compare.hpp>
+#include <bluegrass/meta/lookup.hpp>
+#include <bluegrass/meta/methods.hpp>
+#include <bluegrass/meta/refl.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct message {
+      std::uint64_t id   = 0;
+      std::uint32_t seq  = 0;
+      double price       = 0;
+      std::int32_t qty   = 0;
+      META_REFL(id, seq, price, qty);
+   };
+
+   struct wide_message {
+      int f00, f01, f02, f03, f04, f05, f06, f07, f08, f09;
+      int f10, f11, f12, f13, f14, f15, f16, f17, f18, f19;
+      int f20, f21, f22, f23, f24, f25, f26, f27, f28, f29;
+      META_REFL(f00, f01, f02, f03, f04, f05, f06, f07, f08, f09,
+                f10, f11, f12, f13, f14, f15, f16, f17, f18, f19,
+                f20, f21, f22, f23, f24, f25, f26, f27, f28, f29);
+   };
+
+   struct handler {
+      std::int64_t state = 0;
+      void on_open(std::int64_t v)   { state += v; }
+      void on_close(std::int64_t v)  { state -= v; }
+      void on_update(std::int64_t v) { state ^= v; }
+      void on_cancel(std::int64_t v) { state += 2 * v; }
+      void on_fill(std::int64_t v)   { state -= 2 * v; }
+      void on_expire(std::int64_t v) { state |= v; }
+      void on_amend(std::int64_t v)  { state &= ~v; }
+      void on_reject(std::int64_t v) { state += 3 * v; }
+      META_REFL(state);
+      META_REFL_METHODS(on_open, on_close, on_update, on_cancel, on_fill, on_expire, on_amend, on_reject);
+   };
+
+   struct level0 {
+      std::uint64_t id = 0;
+      double        x  = 0;
+      META_REFL(id, x);
+   };
+
+   struct level1 : level0 {
+      using super_t = level0;
+      std::int32_t qty = 0;
+      float        y   = 0;
+      META_REFL(qty, y);
+   };
+
+   struct level2 : level1 {
+      using super_t = level1;
+      double       z    = 0;
+      std::int64_t seq  = 0;
+      META_REFL(z, seq);
+   };
+
+   struct accumulate {
+      double& total;
+      template <typename T>
+      void operator()(const T& v) const { total += static_cast<double>(v); }
+   };
+
+   std::vector<message> make_messages(std::size_t n) {
+      std::vector<message> msgs(n);
+      for (std::size_t i=0; i < n; i++)
+         msgs[i] = {i, static_cast<std::uint32_t>(i*3), i * 0.5, static_cast<std::int32_t>(i % 100)};
+      return msgs;
+   }
+} // ns anonymous
+
+TEST_CASE("Benchmark get<N> against direct member access", "[get_benchmarks]") {
+   using msg_meta = meta_object<message>;
+   auto msgs = make_messages(4096);
+
+   BENCHMARK("direct member access") {
+      double total = 0;
+      for (const auto& m : msgs)
+         total += m.price * m.qty + m.seq;
+      return total;
+   };
+
+   BENCHMARK("meta_object::get<N>") {
+      double total = 0;
+      for (const auto& m : msgs)
+         total += msg_meta::get<2>(m) * msg_meta::get<3>(m) + msg_meta::get<1>(m);
+      return total;
+   };
+}
+
+TEST_CASE("Benchmark for_each against hand written field visits", "[for_each_benchmarks]") {
+   auto msgs = make_messages(4096);
+
+   // same additions in the same order as the visitor, so only the dispatch differs
+   BENCHMARK("hand written visit") {
+      double total = 0;
+      for (const auto& m : msgs) {
+         total += static_cast<double>(m.id);
+         total += m.seq;
+         total += m.price;
+         total += m.qty;
+      }
+      return total;
+   };
+
+   BENCHMARK("meta_object::for_each") {
+      double total = 0;
+      for (const auto& m : msgs)
+         meta_object<message>::for_each(m, accumulate{total});
+      return total;
+   };
+}
+
+TEST_CASE("Benchmark for_each_full over a 3 level hierarchy", "[for_each_full_benchmarks]") {
+   std::vector<level2> objs(4096);
+   for (std::size_t i=0; i < objs.size(); i++) {
+      objs[i].id = i;
+      objs[i].x = i * 0.5;
+      objs[i].qty = static_cast<std::int32_t>(i % 100);
+      objs[i].y = static_cast<float>(i % 7);
+      objs[i].z = i * 0.25;
+      objs[i].seq = static_cast<std::int64_t>(i * 3);
+   }
+
+   BENCHMARK("hand written visit") {
+      double total = 0;
+      for (const auto& o : objs) {
+         total += static_cast<double>(o.id);
+         total += o.x;
+         total += o.qty;
+         total += o.y;
+         total += o.z;
+         total += static_cast<double>(o.seq);
+      }
+      return total;
+   };
+
+   BENCHMARK("meta_object::for_each_full") {
+      double total = 0;
+      for (const auto& o : objs)
+         meta_object<level2>::for_each_full(o, accumulate{total});
+      return total;
+   };
+}
+
+TEST_CASE("Benchmark type_name against a string literal", "[type_name_benchmarks]") {
+   BENCHMARK("string literal") {
+      std::string_view name = "level2";
+      return name.size();
+   };
+
+   BENCHMARK("meta_object::this_name") {
+      return meta_object<level2>::this_name.size();
+   };
+
+   BENCHMARK("type_name<T>()") {
+      return type_name<level2>().size();
+   };
+}
+
+TEST_CASE("Benchmark the tuple meta_object against std::get", "[tuple_benchmarks]") {
+   using row_t = std::tuple<std::uint64_t, std::uint32_t, double, std::int32_t>;
+   using row_meta = meta_object<row_t>;
+   std::vector<row_t> rows(4096);
+   for (std::size_t i=0; i < rows.size(); i++)
+      rows[i] = row_t{i, static_cast<std::uint32_t>(i*3), i * 0.5, static_cast<std::int32_t>(i % 100)};
+
+   BENCHMARK("std::get") {
+      double total = 0;
+      for (const auto& r : rows)
+         total += std::get<2>(r) * std::get<3>(r) + std::get<1>(r);
+      return total;
+   };
+
+   BENCHMARK("meta_object<tuple>::get<N>") {
+      double total = 0;
+      for (const auto& r : rows)
+         total += row_meta::get<2>(r) * row_meta::get<3>(r) + row_meta::get<1>(r);
+      return total;
+   };
+
+   BENCHMARK("std::apply") {
+      double total = 0;
+      for (const auto& r : rows)
+         std::apply([&](const auto&... fs) { ((total += static_cast<double>(fs)), ...); }, r);
+      return total;
+   };
+
+   BENCHMARK("meta_object<tuple>::for_each") {
+      double total = 0;
+      for (const auto& r : rows)
+         row_meta::for_each(r, accumulate{total});
+      return total;
+   };
+}
+
+TEST_CASE("Benchmark field lookup by name", "[lookup_benchmarks]") {
+   using wide_meta = meta_object<wide_message>;
+   std::vector<std::string> keys;
+   for (std::size_t i=0; i < 256; i++)
+      keys.emplace_back(wide_meta::names[(i * 7) % wide_meta::cardinality]);
+
+   BENCHMARK("linear scan of names") {
+      std::size_t total = 0;
+      for (const auto& k : keys)
+         for (std::size_t i=0; i < wide_meta::cardinality; i++)
+            if (wide_meta::names[i] == k) {
+               total += i;
+               break;
+            }
+      return total;
+   };
+
+   BENCHMARK("find_field perfect hash") {
+      std::size_t total = 0;
+      for (const auto& k : keys)
+         total += find_field<wide_message>(k);
+      return total;
+   };
+}
+
+TEST_CASE("Benchmark generated equality against hand written", "[compare_benchmarks]") {
+   std::vector<wide_message> lhs(4096);
+   for (std::size_t i=0; i < lhs.size(); i++)
+      meta_object<wide_message>::for_each(lhs[i], [&](int& f) { f = static_cast<int>(i); });
+   auto rhs = lhs;
+   rhs.back().f29++;
+
+   BENCHMARK("hand written operator==") {
+      std::size_t total = 0;
+      for (std::size_t i=0; i < lhs.size(); i++) {
+         const auto& a = lhs[i];
+         const auto& b = rhs[i];
+         total += a.f00 == b.f00 && a.f01 == b.f01 && a.f02 == b.f02 && a.f03 == b.f03 && a.f04 == b.f04 &&
+                  a.f05 == b.f05 && a.f06 == b.f06 && a.f07 == b.f07 && a.f08 == b.f08 && a.f09 == b.f09 &&
+                  a.f10 == b.f10 && a.f11 == b.f11 && a.f12 == b.f12 && a.f13 == b.f13 && a.f14 == b.f14 &&
+                  a.f15 == b.f15 && a.f16 == b.f16 && a.f17 == b.f17 && a.f18 == b.f18 && a.f19 == b.f19 &&
+                  a.f20 == b.f20 && a.f21 == b.f21 && a.f22 == b.f22 && a.f23 == b.f23 && a.f24 == b.f24 &&
+                  a.f25 == b.f25 && a.f26 == b.f26 && a.f27 == b.f27 && a.f28 == b.f28 && a.f29 == b.f29;
+      }
+      return total;
+   };
+
+   BENCHMARK("meta::equal") {
+      std::size_t total = 0;
+      for (std::size_t i=0; i < lhs.size(); i++)
+         total += equal(lhs[i], rhs[i]);
+      return total;
+   };
+}
+
+TEST_CASE("Benchmark named method dispatch", "[methods_benchmarks]") {
+   std::vector<std::string> commands;
+   for (std::size_t i=0; i < 1024; i++)
+      commands.emplace_back(meta_methods<handler>::names[(i * 7) % meta_methods<handler>::cardinality]);
+
+   BENCHMARK("if/else router") {
+      handler h;
+      for (const auto& c : commands) {
+         const std::int64_t v = static_cast<std::int64_t>(c.size());
+         if (c == "on_open") h.on_open(v);
+         else if (c == "on_close") h.on_close(v);
+         else if (c == "on_update") h.on_update(v);
+         else if (c == "on_cancel") h.on_cancel(v);
+         else if (c == "on_fill") h.on_fill(v);
+         else if (c == "on_expire") h.on_expire(v);
+         else if (c == "on_amend") h.on_amend(v);
+         else if (c == "on_reject") h.on_reject(v);
+      }
+      return h.state;
+   };
+
+   BENCHMARK("meta_object::invoke by name") {
+      handler h;
+      for (const auto& c : commands)
+         meta_object<handler>::invoke(h, c, static_cast<std::int64_t>(c.size()));
+      return h.state;
+   };
+}
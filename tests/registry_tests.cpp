@@ -0,0 +1,176 @@
+#include <bluegrass/meta/registry.hpp>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct vec2 {
+      float x = 0;
+      float y = 0;
+      META_REFL(x, y);
+   };
+
+   struct shape {
+      std::uint32_t id = 0;
+      std::string   label;
+      META_REFL(id, label);
+   };
+
+   struct circle : shape {
+      using super_t = shape;
+      vec2   center;
+      double radius = 0;
+      META_REFL(center, radius);
+   };
+
+   struct named {
+      std::string name;
+      META_REFL(name);
+   };
+
+   struct named_circle : circle, named {
+      using super_t = base_types_t<circle, named>;
+      std::uint8_t layer = 0;
+      META_REFL(layer);
+   };
+
+   // fields without JSON, hash or copy support
+   struct plugin_state {
+      std::map<int, int>        counts;
+      std::unique_ptr<int>      handle;
+      std::uint16_t             ports[2] = {};
+      META_REFL(counts, handle, ports);
+   };
+} // ns anonymous
+
+TEST_CASE("Testing type descriptors", "[descriptor_tests]") {
+   constexpr const type_descriptor& desc = descriptor_v<circle>;
+   static_assert( desc.size == sizeof(circle) );
+   static_assert( desc.fields.size() == 2 );
+   static_assert( desc.bases.size() == 1 );
+   static_assert( desc.bases[0].type == &descriptor_v<shape> );
+   static_assert( descriptor_v<shape>.bases.size() == 0 );
+   static_assert( desc.fields[0].type == &descriptor_v<vec2> );
+   static_assert( desc.fields[1].type == nullptr );
+
+   REQUIRE( desc.name == meta_object<circle>::this_name );
+   REQUIRE( desc.fields[0].name == "center" );
+   REQUIRE( desc.fields[1].name == "radius" );
+   REQUIRE( desc.fields[1].type_name == "double" );
+   REQUIRE( desc.fields[1].size == sizeof(double) );
+   REQUIRE( desc.bases[0].type->fields[1].name == "label" );
+
+   circle c;
+   c.id = 7;
+   c.label = "wheel";
+   c.center = {1.5f, 2.0f};
+   c.radius = 3.25;
+
+   // dynamic access through the descriptor only
+   const field_descriptor* radius = desc.field("radius");
+   REQUIRE( radius != nullptr );
+   REQUIRE( desc.field("missing") == nullptr );
+   REQUIRE( desc.field_ptr(&c, desc.find("radius")) == &c.radius );
+
+   std::string out;
+   radius->to_string(desc.field_ptr(&c, 1), out);
+   REQUIRE( out == "3.25" );
+   radius->from_string(desc.field_ptr(&c, 1), "4.5");
+   REQUIRE( c.radius == 4.5 );
+
+   const type_descriptor* base = desc.bases[0].type;
+   const void* sub = desc.base_ptr(static_cast<const void*>(&c), 0);
+   REQUIRE( sub == static_cast<const shape*>(&c) );
+   out.clear();
+   base->field("label")->to_string(base->field_ptr(sub, 1), out);
+   REQUIRE( out == "\"wheel\"" );
+
+   out.clear();
+   desc.fields[0].to_string(desc.field_ptr(&c, 0), out);
+   REQUIRE( out == "{\"x\":1.5,\"y\":2}" );
+
+   circle d;
+   for (std::size_t i=0; i < desc.fields.size(); i++)
+      desc.fields[i].copy(desc.field_ptr(&d, i), desc.field_ptr(&c, i));
+   REQUIRE( d.center.x == 1.5f );
+   REQUIRE( d.radius == 4.5 );
+   REQUIRE( desc.fields[1].hash(&d.radius, 0) == hash_value(c.radius) );
+   REQUIRE( desc.fields[0].hash(&d.center, 0) == hash_value(c.center) );
+}
+
+TEST_CASE("Testing descriptors of fields with missing operations", "[descriptor_capability_tests]") {
+   const type_descriptor& desc = descriptor_v<plugin_state>;
+   REQUIRE( desc.fields.size() == 3 );
+
+   const field_descriptor& counts = desc.fields[0];
+   REQUIRE( counts.to_string == nullptr );
+   REQUIRE( counts.from_string == nullptr );
+   REQUIRE( counts.hash == nullptr );
+   REQUIRE( counts.copy != nullptr );
+
+   const field_descriptor& handle = desc.fields[1];
+   REQUIRE( handle.to_string == nullptr );
+   REQUIRE( handle.copy == nullptr );
+   REQUIRE( handle.hash != nullptr );
+
+   // C arrays keep their declared type
+   const field_descriptor& ports = desc.fields[2];
+   REQUIRE( ports.type_name == "unsigned short[2]" );
+   REQUIRE( ports.size == sizeof(std::uint16_t) * 2 );
+   REQUIRE( ports.hash != nullptr );
+
+   plugin_state p;
+   p.ports[1] = 7;
+   REQUIRE( ports.hash(&p.ports, 0) == hash_value(p.ports) );
+}
+
+TEST_CASE("Testing descriptors of several bases", "[descriptor_bases_tests]") {
+   constexpr const type_descriptor& desc = descriptor_v<named_circle>;
+   static_assert( desc.bases.size() == 2 );
+   static_assert( desc.bases[0].type == &descriptor_v<circle> );
+   static_assert( desc.bases[1].type == &descriptor_v<named> );
+
+   named_circle nc;
+   nc.radius = 2;
+   nc.name = "disc";
+   REQUIRE( desc.base_ptr(&nc, 0) == static_cast<circle*>(&nc) );
+   REQUIRE( desc.base_ptr(&nc, 1) == static_cast<named*>(&nc) );
+
+   const type_descriptor* n = desc.bases[1].type;
+   std::string out;
+   n->fields[0].to_string(n->field_ptr(desc.base_ptr(&nc, 1), 0), out);
+   REQUIRE( out == "\"disc\"" );
+   // field type names are spelled the same by every compiler
+   REQUIRE( n->fields[0].type_name == normalized_type_name<std::string>() );
+}
+
+TEST_CASE("Testing the type registry", "[registry_tests]") {
+   auto& reg = type_registry::instance();
+   const std::size_t before = reg.size();
+
+   register_types<shape, circle>();
+   const type_id_t sid = type_id_of<shape>();
+   const type_id_t cid = type_id_of<circle>();
+   REQUIRE( sid != cid );
+   REQUIRE( type_id_of<shape>() == sid );
+   REQUIRE( reg.size() == before + 2 );
+   REQUIRE( reg.get(cid) == &descriptor_v<circle> );
+   REQUIRE( reg.get(invalid_type_id) == nullptr );
+   REQUIRE( reg.find(meta_object<circle>::this_name) == cid );
+   REQUIRE( reg.find("no_such_type") == invalid_type_id );
+   REQUIRE( reg.add(&descriptor_v<circle>) == cid );
+
+   // a distinct descriptor under a registered name
+   static const type_descriptor impostor = descriptor_v<circle>;
+   REQUIRE_THROWS_AS( reg.add(&impostor), std::invalid_argument );
+   REQUIRE( reg.size() == before + 2 );
+}
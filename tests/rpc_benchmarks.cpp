@@ -0,0 +1,91 @@
+#include <bluegrass/meta/rpc.hpp>
+
+#include <any>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct service {
+      std::int64_t total = 0;
+
+      std::int64_t add(std::int32_t a, std::int64_t b) { return total += a + b; }
+      std::size_t  lookup(std::string_view key, std::uint32_t salt) { return key.size() + salt; }
+   };
+
+   using add_m    = rpc_method<rpc_id("add"), &service::add>;
+   using lookup_m = rpc_method<rpc_id("lookup"), &service::lookup>;
+   using service_rpc = rpc_dispatcher<service, add_m, lookup_m>;
+
+   // the boxed baseline: every argument becomes a std::any, handlers are std::function
+   using boxed_handler = std::function<std::any(service&, std::vector<std::any>&)>;
+
+   std::vector<std::any> unbox_add(span<const std::byte> in) {
+      byte_reader rd{in};
+      std::int32_t a;
+      std::int64_t b;
+      unpack(rd, a);
+      unpack(rd, b);
+      return {std::any{a}, std::any{b}};
+   }
+
+   std::vector<std::any> unbox_lookup(span<const std::byte> in) {
+      byte_reader rd{in};
+      std::string key;
+      std::uint32_t salt;
+      unpack(rd, key);
+      unpack(rd, salt);
+      return {std::any{std::move(key)}, std::any{salt}};
+   }
+} // ns anonymous
+
+TEST_CASE("Benchmark rpc dispatch", "[rpc_benchmarks]") {
+   service svc;
+   std::vector<std::byte> add_args(args_size<add_m>(1, 2));
+   encode_args<add_m>(add_args, 1, 2);
+   const std::string key = "a key long enough to not fit in the small string buffer";
+   std::vector<std::byte> lookup_args(args_size<lookup_m>(key, 7u));
+   encode_args<lookup_m>(lookup_args, key, 7u);
+   std::vector<std::byte> out(16);
+
+   std::unordered_map<method_id_t, boxed_handler> boxed;
+   boxed[add_m::id] = [](service& s, std::vector<std::any>& a) -> std::any {
+      return s.add(std::any_cast<std::int32_t>(a[0]), std::any_cast<std::int64_t>(a[1]));
+   };
+   boxed[lookup_m::id] = [](service& s, std::vector<std::any>& a) -> std::any {
+      return s.lookup(std::any_cast<const std::string&>(a[0]), std::any_cast<std::uint32_t>(a[1]));
+   };
+   const auto boxed_call = [&](method_id_t id, std::vector<std::any> args) {
+      const std::any r = boxed.at(id)(svc, args);
+      byte_writer wr{out};
+      if (id == add_m::id)
+         pack(wr, std::any_cast<std::int64_t>(r));
+      else
+         pack(wr, std::any_cast<std::size_t>(r));
+      return wr.tellp();
+   };
+
+   BENCHMARK("rpc_dispatcher add(int32, int64)") {
+      return service_rpc::dispatch(svc, add_m::id, add_args, out);
+   };
+
+   BENCHMARK("boxed add(int32, int64)") {
+      return boxed_call(add_m::id, unbox_add(add_args));
+   };
+
+   BENCHMARK("rpc_dispatcher lookup(string_view, uint32)") {
+      return service_rpc::dispatch(svc, lookup_m::id, lookup_args, out);
+   };
+
+   BENCHMARK("boxed lookup(string, uint32)") {
+      return boxed_call(lookup_m::id, unbox_lookup(lookup_args));
+   };
+}
@@ -0,0 +1,140 @@
+#include <bluegrass/meta/rpc.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct order {
+      std::uint64_t id = 0;
+      std::string   symbol;
+      std::int64_t  qty = 0;
+      META_REFL(id, symbol, qty);
+   };
+
+   struct book {
+      std::vector<order> orders;
+      std::uint32_t      version = 0;
+      const char*        last_view = nullptr;
+
+      std::int64_t add(std::int32_t a, std::int64_t b) { return a + b; }
+      void set_version(std::uint32_t v) { version = v; }
+      std::uint32_t get_version() const { return version; }
+
+      std::size_t place(const order& o) {
+         orders.push_back(o);
+         return orders.size();
+      }
+
+      std::string greet(std::string_view name) {
+         last_view = name.data();
+         return "hello " + std::string(name);
+      }
+
+      std::size_t total(const std::string& prefix, const std::vector<std::int64_t>& qtys) {
+         std::int64_t sum = 0;
+         for (auto q : qtys)
+            sum += q;
+         return prefix.size() + static_cast<std::size_t>(sum);
+      }
+   };
+
+   std::uint64_t square(std::uint64_t v) { return v * v; }
+
+   using add_m         = rpc_method<rpc_id("add"), &book::add>;
+   using set_version_m = rpc_method<rpc_id("set_version"), &book::set_version>;
+   using get_version_m = rpc_method<rpc_id("get_version"), &book::get_version>;
+   using place_m       = rpc_method<rpc_id("place"), &book::place>;
+   using greet_m       = rpc_method<rpc_id("greet"), &book::greet>;
+   using total_m       = rpc_method<rpc_id("total"), &book::total>;
+   using square_m      = rpc_method<7, &square>;
+
+   using book_rpc = rpc_dispatcher<book, add_m, set_version_m, get_version_m, place_m, greet_m, total_m, square_m>;
+
+   template <typename Method, typename... Args>
+   std::vector<std::byte> call(book& b, const Args&... args) {
+      std::vector<std::byte> in(args_size<Method>(args...));
+      encode_args<Method>(in, args...);
+      std::vector<std::byte> out(256);
+      out.resize(book_rpc::dispatch(b, Method::id, in, out));
+      return out;
+   }
+
+   template <typename Method, typename... Args>
+   auto call_result(book& b, const Args&... args) {
+      const auto out = call<Method>(b, args...);
+      return decode_result<Method>(out);
+   }
+} // ns anonymous
+
+TEST_CASE("Testing rpc dispatch", "[rpc_tests]") {
+   book b;
+   REQUIRE( book_rpc::size == 7 );
+   REQUIRE( book_rpc::contains(rpc_id("greet")) );
+   REQUIRE( !book_rpc::contains(rpc_id("missing")) );
+
+   REQUIRE( call_result<add_m>(b, 2, 40) == 42 );
+
+   REQUIRE( call<set_version_m>(b, 9u).empty() );
+   REQUIRE( b.version == 9 );
+   REQUIRE( call_result<get_version_m>(b) == 9 );
+
+   order o;
+   o.id = 5;
+   o.symbol = "ABC";
+   o.qty = -3;
+   REQUIRE( call_result<place_m>(b, o) == 1 );
+   REQUIRE( b.orders[0].symbol == "ABC" );
+   REQUIRE( b.orders[0].qty == -3 );
+
+   REQUIRE( call_result<total_m>(b, "ab", std::vector<std::int64_t>{1, 2, 3}) == 8 );
+   REQUIRE( call_result<square_m>(b, std::uint64_t{12}) == 144 );
+}
+
+TEST_CASE("Testing rpc string_view arguments", "[rpc_string_view_tests]") {
+   book b;
+   std::vector<std::byte> in(args_size<greet_m>("world"));
+   encode_args<greet_m>(in, "world");
+   // same encoding as a std::string argument
+   REQUIRE( in.size() == sizeof(length_prefix_t) + 5 );
+
+   std::vector<std::byte> out(64);
+   out.resize(book_rpc::dispatch(b, greet_m::id, in, out));
+   REQUIRE( decode_result<greet_m>(out) == "hello world" );
+   // the argument was a view into the request buffer
+   REQUIRE( b.last_view == reinterpret_cast<const char*>(in.data() + sizeof(length_prefix_t)) );
+}
+
+TEST_CASE("Testing rpc errors", "[rpc_error_tests]") {
+   book b;
+   std::vector<std::byte> out(8);
+   REQUIRE_THROWS_AS( book_rpc::dispatch(b, rpc_id("missing"), {}, out), std::invalid_argument );
+
+   // truncated arguments
+   std::vector<std::byte> in(args_size<add_m>(1, 2));
+   encode_args<add_m>(in, 1, 2);
+   REQUIRE_THROWS_AS( book_rpc::dispatch(b, add_m::id, span<const std::byte>{in.data(), in.size() - 1}, out), std::out_of_range );
+
+   // trailing bytes after the arguments
+   std::vector<std::byte> longer(in);
+   longer.push_back(std::byte{0});
+   REQUIRE_THROWS_AS( book_rpc::dispatch(b, add_m::id, longer, out), std::invalid_argument );
+
+   // result doesn't fit
+   std::vector<std::byte> small(4);
+   REQUIRE_THROWS_AS( book_rpc::dispatch(b, add_m::id, in, small), std::out_of_range );
+
+   // free functions only
+   using free_rpc = rpc_dispatcher<freestanding, square_m>;
+   std::vector<std::byte> arg(8);
+   encode_args<square_m>(arg, std::uint64_t{3});
+   REQUIRE( free_rpc::dispatch(square_m::id, arg, out) == 8 );
+   REQUIRE( decode_result<square_m>(out) == 9 );
+}
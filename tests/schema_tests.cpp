@@ -0,0 +1,127 @@
+#include <bluegrass/meta/schema.hpp>
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct order_v1 {
+      std::uint64_t id = 0;
+      double        price = 0;
+      std::string   symbol;
+      META_REFL(id, price, symbol);
+   };
+
+   // same fields under another name
+   struct order_renamed {
+      std::uint64_t id = 0;
+      double        price = 0;
+      std::string   symbol;
+      META_REFL(id, price, symbol);
+   };
+
+   struct order_reordered {
+      double        price = 0;
+      std::uint64_t id = 0;
+      std::string   symbol;
+      META_REFL(price, id, symbol);
+   };
+
+   struct order_retyped {
+      std::uint64_t id = 0;
+      float         price = 0;
+      std::string   symbol;
+      META_REFL(id, price, symbol);
+   };
+
+   struct order_field_renamed {
+      std::uint64_t id = 0;
+      double        px = 0;
+      std::string   symbol;
+      META_REFL(id, px, symbol);
+   };
+
+   struct base_part {
+      std::uint64_t id = 0;
+      META_REFL(id);
+   };
+
+   struct derived_order : base_part {
+      using super_t = base_part;
+      double      price = 0;
+      std::string symbol;
+      META_REFL(price, symbol);
+   };
+
+   struct book_v1 {
+      std::vector<order_v1>         orders;
+      std::array<order_v1, 2>       best;
+      META_REFL(orders, best);
+   };
+
+   struct book_renamed {
+      std::vector<order_renamed>    orders;
+      std::array<order_renamed, 2>  best;
+      META_REFL(orders, best);
+   };
+
+   // only the element type of the vector changed
+   struct book_nested_change {
+      std::vector<order_retyped>    orders;
+      std::array<order_v1, 2>       best;
+      META_REFL(orders, best);
+   };
+
+   int dispatch(std::uint64_t type) {
+      switch (type) {
+         case type_hash_v<order_v1>:      return 1;
+         case type_hash_v<order_renamed>: return 2;
+         default:                         return 0;
+      }
+   }
+} // ns anonymous
+
+TEST_CASE("Testing normalized type names", "[normalized_type_name_tests]") {
+   REQUIRE( normalized_type_name<std::string>() == "std::basic_string<char>" );
+   REQUIRE( normalized_type_name<std::vector<std::string>>() == "std::vector<std::basic_string<char>>" );
+   REQUIRE( normalized_type_name<std::map<int, std::vector<int>>>() == "std::map<int, std::vector<int>>" );
+   REQUIRE( normalized_type_name<std::tuple<short, unsigned long, long long>>() == "std::tuple<short, unsigned long, long long>" );
+   REQUIRE( normalized_type_name<unsigned long long>() == "unsigned long long" );
+   REQUIRE( normalized_type_name<const char*>() == "const char*" );
+   REQUIRE( normalized_type_name<int[3]>() == "int[3]" );
+   REQUIRE( normalized_type_name<order_v1>() == "{anonymous}::order_v1" );
+   REQUIRE( meta_object<std::tuple<int, float, std::string>>::normalized_name == "std::tuple<int, float, std::basic_string<char>>" );
+   REQUIRE( meta_object<order_v1>::normalized_name == normalized_type_name<order_v1>() );
+}
+
+TEST_CASE("Testing type ids and schema fingerprints", "[schema_tests]") {
+   static_assert( type_hash_v<order_v1> != type_hash_v<order_renamed> );
+   static_assert( type_hash_v<std::string> == detail::fnv1a("std::basic_string<char>") );
+   REQUIRE( dispatch(type_hash_v<order_renamed>) == 2 );
+   REQUIRE( dispatch(type_hash_v<int>) == 0 );
+
+   static_assert( schema_fingerprint_v<order_v1> == schema_fingerprint_v<order_renamed> );
+   static_assert( schema_fingerprint_v<order_v1> != schema_fingerprint_v<order_reordered> );
+   static_assert( schema_fingerprint_v<order_v1> != schema_fingerprint_v<order_retyped> );
+   static_assert( schema_fingerprint_v<order_v1> != schema_fingerprint_v<order_field_renamed> );
+   // the hierarchy is flattened, bases first
+   static_assert( schema_fingerprint_v<order_v1> == schema_fingerprint_v<derived_order> );
+
+   static_assert( schema_fingerprint_v<std::tuple<int, double>> != schema_fingerprint_v<std::tuple<double, int>> );
+   static_assert( schema_fingerprint_v<std::tuple<order_v1>> == schema_fingerprint_v<std::tuple<order_renamed>> );
+
+   // elements of containers contribute their fields, not their name
+   static_assert( schema_fingerprint_v<book_v1> == schema_fingerprint_v<book_renamed> );
+   static_assert( schema_fingerprint_v<book_v1> != schema_fingerprint_v<book_nested_change> );
+   static_assert( schema_fingerprint_v<std::vector<order_v1>> != schema_fingerprint_v<std::vector<order_retyped>> );
+   static_assert( schema_fingerprint_v<std::array<order_v1, 2>> != schema_fingerprint_v<std::array<order_v1, 3>> );
+   static_assert( schema_fingerprint_v<order_v1[2]> == schema_fingerprint_v<std::array<order_renamed, 2>> );
+}
@@ -0,0 +1,92 @@
+#include <bluegrass/meta/lazy.hpp>
+#include <bluegrass/meta/serialize.hpp>
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct order {
+      std::uint64_t    id = 0;
+      double           price = 0;
+      std::string      symbol;
+      std::string      account;
+      std::vector<std::uint32_t> fills;
+      META_REFL(id, price, symbol, account, fills);
+   };
+
+   // order with its variable length storage on a std::pmr::memory_resource, same encoding
+   struct pmr_order {
+      std::uint64_t    id = 0;
+      double           price = 0;
+      std::pmr::string symbol;
+      std::pmr::string account;
+      std::pmr::vector<std::uint32_t> fills;
+      META_REFL(id, price, symbol, account, fills);
+   };
+
+   // a routing header in front of a large payload
+   struct envelope {
+      std::uint32_t route = 0;
+      std::uint64_t deadline = 0;
+      std::string   topic;
+      std::vector<std::string>   headers;
+      std::vector<std::uint64_t> body;
+      META_REFL(route, deadline, topic, headers, body);
+   };
+} // ns anonymous
+
+TEST_CASE("Benchmark batch deserialization into an arena", "[serialize_pmr_benchmarks]") {
+   std::vector<order> batch(10000);
+   for (std::size_t i=0; i < batch.size(); i++) {
+      batch[i].id      = i;
+      batch[i].price   = 1.5 * i;
+      batch[i].symbol  = "a symbol past the small string buffer " + std::to_string(i);
+      batch[i].account = "an account past the small string buffer " + std::to_string(i);
+      batch[i].fills   = {1, 2, 3, 4};
+   }
+   std::vector<std::byte> buf(serialized_size(batch));
+   serialize(batch, buf);
+
+   BENCHMARK("std::vector<order> from the heap") {
+      std::vector<order> out;
+      deserialize(out, buf);
+      return out.size();
+   };
+
+   BENCHMARK("std::pmr::vector<pmr_order> from a monotonic arena") {
+      std::pmr::monotonic_buffer_resource arena{buf.size() * 2};
+      std::pmr::vector<pmr_order> out;
+      deserialize(out, buf, &arena);
+      return out.size();
+   };
+}
+
+TEST_CASE("Benchmark lazy_object header reads against full deserialization", "[lazy_benchmarks]") {
+   envelope e;
+   e.route    = 7;
+   e.deadline = 1234;
+   e.topic    = "a topic past the small string buffer";
+   for (std::size_t i=0; i < 32; i++)
+      e.headers.push_back("header value past the small string buffer " + std::to_string(i));
+   e.body.resize(4096, 42);
+   std::vector<std::byte> buf(serialized_size(e));
+   serialize(e, buf);
+
+   BENCHMARK("deserialize then read route and deadline") {
+      envelope out;
+      deserialize(out, buf);
+      return out.route + out.deadline;
+   };
+
+   BENCHMARK("lazy_object get<0> and get<1>") {
+      lazy_object<envelope> lazy{buf};
+      return lazy.get<0>() + lazy.get<1>();
+   };
+}
@@ -0,0 +1,286 @@
+#include <bluegrass/meta/serialize.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   enum class fixed_kind : std::uint8_t { a, b };
+   enum loose_kind { loose_a, loose_b };
+
+   // not reflected, 3 padding bytes after c
+   struct padded_pod {
+      char         c;
+      std::int32_t i;
+   };
+
+   struct flagged {
+      std::uint32_t id = 0;
+      bool          on = false;
+      std::uint8_t  level = 0;
+      META_REFL(id, on, level);
+   };
+
+   struct point {
+      std::int32_t x = 0;
+      std::int32_t y = 0;
+      META_REFL(x, y);
+   };
+
+   struct padded {
+      std::uint8_t  a = 0;
+      std::uint64_t b = 0;
+      std::uint16_t c = 0;
+      META_REFL(a, b, c);
+   };
+
+   struct record {
+      std::uint64_t id = 0;
+      std::uint32_t seq = 0;
+      std::string   name;
+      point         pos;
+      std::vector<std::uint16_t> tags;
+      std::vector<std::string>   notes;
+      META_REFL(id, seq, name, pos, tags, notes);
+   };
+
+   struct derived_record : record {
+      using super_t = record;
+      double weight = 0;
+      META_REFL(weight);
+   };
+
+   struct tagged {
+      std::uint16_t tag = 0;
+      std::string   label;
+      META_REFL(tag, label);
+   };
+
+   struct tagged_point : point, tagged {
+      using super_t = base_types_t<point, tagged>;
+      std::int32_t z = 0;
+      META_REFL(z);
+   };
+
+   struct pmr_record {
+      std::uint64_t                       id = 0;
+      std::pmr::string                    name;
+      std::pmr::vector<std::uint32_t>     tags;
+      std::pmr::vector<std::pmr::string>  notes;
+      META_REFL(id, name, tags, notes);
+   };
+
+   // counts the bytes requested from it, forwarding to upstream
+   struct counting_resource : std::pmr::memory_resource {
+      std::pmr::memory_resource* upstream = std::pmr::new_delete_resource();
+      std::size_t                allocations = 0;
+
+      void* do_allocate(std::size_t bytes, std::size_t align) override {
+         allocations++;
+         return upstream->allocate(bytes, align);
+      }
+      void do_deallocate(void* p, std::size_t bytes, std::size_t align) override { upstream->deallocate(p, bytes, align); }
+      bool do_is_equal(const std::pmr::memory_resource& o) const noexcept override { return this == &o; }
+   };
+} // ns anonymous
+
+TEST_CASE("Testing fixed size types", "[serialize_fixed_tests]") {
+   REQUIRE( is_fixed_size_v<point> );
+   REQUIRE( is_fixed_size_v<padded> );
+   REQUIRE( is_fixed_size_v<std::tuple<int, point>> );
+   REQUIRE( !is_fixed_size_v<record> );
+   REQUIRE( !is_fixed_size_v<std::tuple<int, std::string>> );
+
+   // padding never reaches the wire
+   static_assert( max_serialized_size<padded>() == 1 + 8 + 2 );
+   static_assert( max_serialized_size<point>() == 8 );
+   static_assert( max_serialized_size<std::tuple<int, point>>() == 12 );
+
+   padded p = {7, 0x0102030405060708, 0xBEEF};
+   std::array<std::byte, max_serialized_size<padded>()> buf = {};
+   REQUIRE( serialize(p, buf) == buf.size() );
+
+   padded p2;
+   REQUIRE( deserialize(p2, buf) == buf.size() );
+   REQUIRE( p2.a == 7 );
+   REQUIRE( p2.b == 0x0102030405060708 );
+   REQUIRE( p2.c == 0xBEEF );
+}
+
+TEST_CASE("Testing variable size types", "[serialize_variable_tests]") {
+   derived_record r;
+   r.id = 42;
+   r.seq = 7;
+   r.name = "hello";
+   r.pos = {3, -4};
+   r.tags = {1, 2, 3};
+   r.notes = {"a", "bc"};
+   r.weight = 13.5;
+
+   const std::size_t size = serialized_size(r);
+   REQUIRE( size == 8 + 4 + (4 + 5) + 8 + (4 + 3*2) + (4 + (4 + 1) + (4 + 2)) + 8 );
+
+   std::vector<std::byte> buf(size);
+   REQUIRE( serialize(r, buf) == size );
+
+   derived_record r2;
+   r2.name.reserve(64);
+   REQUIRE( deserialize(r2, buf) == size );
+   REQUIRE( r2.id == 42 );
+   REQUIRE( r2.seq == 7 );
+   REQUIRE( r2.name == "hello" );
+   REQUIRE( r2.pos.x == 3 );
+   REQUIRE( r2.pos.y == -4 );
+   REQUIRE( r2.tags == std::vector<std::uint16_t>{1, 2, 3} );
+   REQUIRE( r2.notes == std::vector<std::string>{"a", "bc"} );
+   REQUIRE( r2.weight == 13.5 );
+
+   std::vector<std::byte> small(size - 1);
+   REQUIRE_THROWS_AS( serialize(r, small), std::out_of_range );
+   REQUIRE_THROWS_AS( deserialize(r2, span<const std::byte>{buf.data(), size - 1}), std::out_of_range );
+}
+
+TEST_CASE("Testing untrusted input", "[serialize_untrusted_tests]") {
+   // addresses are never read from the wire
+   static_assert( !detail::is_raw_v<int*> );
+   static_assert( !detail::is_raw_v<const char*> );
+   static_assert( !detail::is_raw_v<int point::*> );
+   static_assert( !detail::is_raw_v<std::array<void*, 2>> );
+   static_assert( detail::is_raw_v<std::array<int, 2>> );
+
+   // a length no input of this size can hold is rejected before allocating
+   const length_prefix_t len = 0xFFFFFFFF;
+   std::array<std::byte, sizeof(len)> buf;
+   std::memcpy(buf.data(), &len, sizeof(len));
+   std::vector<std::string> strings;
+   REQUIRE_THROWS_AS( deserialize(strings, buf), std::out_of_range );
+   REQUIRE( strings.capacity() == 0 );
+   std::vector<point> points;
+   REQUIRE_THROWS_AS( deserialize(points, buf), std::out_of_range );
+
+   // padding bytes are never written, such types must be reflected
+   static_assert( !detail::is_raw_v<padded_pod> );
+   static_assert( detail::is_raw_v<std::array<std::uint16_t, 3>> );
+
+   // only bytes that are always valid values are copied without a check
+   static_assert( detail::has_fixed_underlying<fixed_kind>::value );
+   static_assert( !detail::has_fixed_underlying<loose_kind>::value );
+   static_assert( detail::is_memcpy_decodable_v<fixed_kind> );
+   static_assert( !detail::is_memcpy_decodable_v<bool> );
+   static_assert( !detail::is_memcpy_decodable_v<std::array<bool, 2>> );
+   static_assert( !detail::is_memcpy_decodable_v<loose_kind> );
+
+   flagged f;
+   f.id = 7;
+   f.on = true;
+   f.level = 3;
+   std::vector<std::byte> fb(serialized_size(f));
+   REQUIRE( fb.size() == 4 + 1 + 1 );
+   serialize(f, fb);
+   flagged g;
+   deserialize(g, fb);
+   REQUIRE( g.id == 7 );
+   REQUIRE( g.on );
+   REQUIRE( g.level == 3 );
+
+   fb[4] = std::byte{2};
+   REQUIRE_THROWS_AS( deserialize(g, fb), std::invalid_argument );
+
+   std::array<bool, 2> flags = {true, false};
+   std::vector<std::byte> ab(serialized_size(flags));
+   serialize(flags, ab);
+   ab[1] = std::byte{0xFF};
+   REQUIRE_THROWS_AS( deserialize(flags, ab), std::invalid_argument );
+}
+
+TEST_CASE("Testing tuple serialization", "[serialize_tuple_tests]") {
+   std::tuple<int, float, std::string> t = {42, 4.2f, "tuple"};
+   std::vector<std::byte> buf(serialized_size(t));
+   REQUIRE( buf.size() == 4 + 4 + 4 + 5 );
+   serialize(t, buf);
+
+   std::tuple<int, float, std::string> t2;
+   deserialize(t2, buf);
+   REQUIRE( t2 == t );
+}
+
+TEST_CASE("Testing serialization with several bases", "[serialize_multi_base_tests]") {
+   tagged_point p;
+   p.x = 1;
+   p.y = -2;
+   p.tag = 3;
+   p.label = "four";
+   p.z = 5;
+
+   REQUIRE( !is_fixed_size_v<tagged_point> );
+   const std::size_t size = serialized_size(p);
+   REQUIRE( size == 4 + 4 + 2 + (4 + 4) + 4 );
+
+   std::vector<std::byte> buf(size);
+   REQUIRE( serialize(p, buf) == size );
+   tagged_point p2;
+   REQUIRE( deserialize(p2, buf) == size );
+   REQUIRE( p2.x == 1 );
+   REQUIRE( p2.y == -2 );
+   REQUIRE( p2.tag == 3 );
+   REQUIRE( p2.label == "four" );
+   REQUIRE( p2.z == 5 );
+}
+
+TEST_CASE("Testing deserialization into a memory resource", "[serialize_pmr_tests]") {
+   std::pmr::vector<pmr_record> batch;
+   for (std::uint64_t i=0; i < 64; i++) {
+      pmr_record r;
+      r.id = i;
+      r.name = "a name long enough to not fit in the small string buffer";
+      r.tags = {1, 2, 3};
+      r.notes = {"first note that also needs an allocation", "second"};
+      batch.push_back(std::move(r));
+   }
+   // same encoding as the std:: containers
+   REQUIRE( serialized_size(batch[0]) == 8 + (4 + 56) + (4 + 3*4) + (4 + (4 + 40) + (4 + 6)) );
+   std::vector<std::byte> buf(serialized_size(batch));
+   serialize(batch, buf);
+
+   counting_resource upstream;
+   std::pmr::monotonic_buffer_resource arena{64 * 1024, &upstream};
+   std::pmr::vector<pmr_record> out;
+   out.resize(2);
+   out[0].name = "decoded over, storage from the default resource";
+
+   // nothing may come from the default resource while decoding
+   std::pmr::memory_resource* prev = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+   const std::size_t consumed = deserialize(out, buf, &arena);
+   std::pmr::set_default_resource(prev);
+
+   REQUIRE( consumed == buf.size() );
+   REQUIRE( out.size() == 64 );
+   REQUIRE( out.get_allocator().resource() == &arena );
+   for (std::uint64_t i=0; i < 64; i++) {
+      REQUIRE( out[i].id == i );
+      REQUIRE( out[i].name == batch[i].name );
+      REQUIRE( out[i].name.get_allocator().resource() == &arena );
+      REQUIRE( out[i].tags == batch[i].tags );
+      REQUIRE( out[i].tags.get_allocator().resource() == &arena );
+      REQUIRE( out[i].notes == batch[i].notes );
+      REQUIRE( out[i].notes[0].get_allocator().resource() == &arena );
+   }
+   // a handful of large blocks for several hundred strings and vectors
+   REQUIRE( upstream.allocations < 8 );
+
+   // without a resource the containers keep their own
+   pmr_record r;
+   deserialize(r, span<const std::byte>{buf.data() + sizeof(length_prefix_t), buf.size() - sizeof(length_prefix_t)});
+   REQUIRE( r.name == batch[0].name );
+   REQUIRE( r.name.get_allocator().resource() == std::pmr::get_default_resource() );
+}
@@ -0,0 +1,115 @@
+#include <bluegrass/meta/soa.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct trade {
+      std::uint64_t id = 0;
+      double price = 0;
+      std::int32_t qty = 0;
+      std::string symbol;
+      META_REFL(id, price, qty, symbol);
+   };
+
+   struct throwing_copy {
+      bool fail = false;
+      throwing_copy() = default;
+      throwing_copy(bool f) : fail(f) {}
+      throwing_copy(const throwing_copy& o) : fail(o.fail) {
+         if (fail)
+            throw std::runtime_error("copy failed");
+      }
+   };
+
+   struct fragile {
+      std::uint64_t id = 0;
+      throwing_copy payload;
+      std::string name;
+      META_REFL(id, payload, name);
+   };
+} // ns anonymous
+
+TEST_CASE("Testing meta_soa_vector columns", "[soa_column_tests]") {
+   meta_soa_vector<trade> trades;
+   REQUIRE( trades.empty() );
+   trades.reserve(16);
+   for (std::uint64_t i=0; i < 10; i++)
+      trades.push_back({i, i * 1.5, static_cast<std::int32_t>(i * 10), "sym" + std::to_string(i)});
+
+   REQUIRE( trades.size() == 10 );
+
+   auto prices = trades.column<1>();
+   REQUIRE( std::is_same_v<decltype(prices), span<double>> );
+   REQUIRE( prices.size() == 10 );
+   double total = 0;
+   for (double p : prices)
+      total += p;
+   REQUIRE( total == 1.5 * 45 );
+
+   prices[3] = 100;
+   const auto& ctrades = trades;
+   REQUIRE( ctrades.column<1>()[3] == 100 );
+   REQUIRE( ctrades.column<3>()[9] == "sym9" );
+   REQUIRE( ctrades.column<0>().data() + 1 == &ctrades.column<0>()[1] );
+
+   trades.clear();
+   REQUIRE( trades.empty() );
+}
+
+TEST_CASE("Testing meta_soa_vector rows", "[soa_row_tests]") {
+   meta_soa_vector<trade> trades;
+   trades.push_back({1, 2.5, 3, "abc"});
+   trades.push_back({4, 5.5, 6, "def"});
+
+   auto row = trades[1];
+   REQUIRE( std::get<0>(row) == 4 );
+   REQUIRE( std::get<3>(row) == "def" );
+   std::get<2>(row) = 60;
+   REQUIRE( trades.column<2>()[1] == 60 );
+
+   // for_each visits every field of the row by reference
+   using row_meta = meta_object_t<meta_soa_vector<trade>::reference>;
+   row_meta::for_each(trades[0], [](auto& f) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(f)>, std::string>)
+         f += "!";
+      else
+         f += 1;
+   });
+   REQUIRE( trades.column<0>()[0] == 2 );
+   REQUIRE( trades.column<1>()[0] == 3.5 );
+   REQUIRE( trades.column<2>()[0] == 4 );
+   REQUIRE( trades.column<3>()[0] == "abc!" );
+
+   const auto& ctrades = trades;
+   REQUIRE( std::is_same_v<decltype(ctrades[0]), meta_soa_vector<trade>::const_reference> );
+   REQUIRE( std::get<1>(ctrades[1]) == 5.5 );
+}
+
+TEST_CASE("Testing meta_soa_vector push_back rollback", "[soa_rollback_tests]") {
+   meta_soa_vector<fragile> rows;
+   rows.push_back({1, {}, "a"});
+
+   fragile bad;
+   bad.id = 2;
+   bad.name = "b";
+   bad.payload.fail = true;
+   REQUIRE_THROWS_AS( rows.push_back(bad), std::runtime_error );
+
+   // the id column was appended to before the payload threw and must have been rolled back
+   REQUIRE( rows.size() == 1 );
+   REQUIRE( rows.column<0>().size() == 1 );
+   REQUIRE( rows.column<1>().size() == 1 );
+   REQUIRE( rows.column<2>().size() == 1 );
+
+   rows.push_back({3, {}, "c"});
+   REQUIRE( rows.size() == 2 );
+   REQUIRE( rows.column<0>()[1] == 3 );
+   REQUIRE( rows.column<2>()[1] == "c" );
+}
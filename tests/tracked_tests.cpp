@@ -0,0 +1,93 @@
+#include <bluegrass/meta/tracked.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct account {
+      std::uint64_t id = 0;
+      std::string   owner;
+      std::int64_t  balance = 0;
+      META_REFL(id, owner, balance);
+   };
+
+   struct savings : account {
+      using super_t = account;
+      double rate = 0;
+      std::vector<std::int64_t> history;
+      META_REFL(rate, history);
+   };
+} // ns anonymous
+
+TEST_CASE("Testing dirty tracking", "[tracked_tests]") {
+   tracked<account> acc{account{1, "alice", 100}};
+   REQUIRE( !acc.dirty() );
+   REQUIRE( acc.get<1>() == "alice" ); // mutable get marks the field
+   REQUIRE( acc.is_dirty<1>() );
+   acc.clear_dirty();
+
+   const auto& cacc = acc;
+   REQUIRE( cacc.get<&account::owner>() == "alice" );
+   REQUIRE( !acc.dirty() );
+
+   acc.set<2>(250);
+   REQUIRE( acc.value().balance == 250 );
+   REQUIRE( acc.dirty() );
+   REQUIRE( acc.dirty_count() == 1 );
+   REQUIRE( acc.is_dirty<&account::balance>() );
+   REQUIRE( !acc.is_dirty<0>() );
+
+   acc.get<&account::owner>() += " smith";
+   REQUIRE( acc.value().owner == "alice smith" );
+   REQUIRE( acc.dirty_count() == 2 );
+
+   std::vector<std::string_view> names;
+   acc.for_each_dirty([&](std::string_view name, const auto&) { names.push_back(name); });
+   REQUIRE( names == std::vector<std::string_view>{"owner", "balance"} );
+
+   account follower{1, "alice", 100};
+   const auto patch = acc.patch();
+   REQUIRE( changed_fields<account>(patch) == 2 );
+   REQUIRE( meta::apply(follower, patch) == patch.size() );
+   REQUIRE( follower.owner == "alice smith" );
+   REQUIRE( follower.balance == 250 );
+
+   acc.clear_dirty();
+   REQUIRE( !acc.dirty() );
+   REQUIRE( acc.patch().size() == 1 );
+}
+
+TEST_CASE("Testing dirty tracking over a hierarchy", "[tracked_hierarchy_tests]") {
+   tracked<savings> sav;
+   REQUIRE( tracked<savings>::cardinality == 5 );
+
+   sav.set<&account::balance>(10);
+   sav.set<&savings::rate>(0.5);
+   sav.get<1>().push_back(10);
+   REQUIRE( sav.is_dirty<&account::balance>() );
+   REQUIRE( sav.is_dirty<0>() );
+   REQUIRE( sav.is_dirty<&savings::history>() );
+   REQUIRE( !sav.is_dirty<&account::id>() );
+   REQUIRE( sav.dirty_count() == 3 );
+
+   std::vector<std::string_view> names;
+   sav.for_each_dirty([&](std::string_view name, const auto&) { names.push_back(name); });
+   REQUIRE( names == std::vector<std::string_view>{"balance", "rate", "history"} );
+
+   savings follower;
+   follower.owner = "bob";
+   std::vector<std::byte> buf(64);
+   const std::size_t n = sav.patch(buf);
+   REQUIRE( meta::apply(follower, span<const std::byte>(buf.data(), n)) == n );
+   REQUIRE( follower.owner == "bob" );
+   REQUIRE( follower.balance == 10 );
+   REQUIRE( follower.rate == 0.5 );
+   REQUIRE( follower.history == std::vector<std::int64_t>{10} );
+}
@@ -0,0 +1,62 @@
+#include <bluegrass/meta/versioned.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct tick {
+      std::uint64_t seq = 0;
+      std::uint64_t ts = 0;
+      double        bid = 0;
+      double        ask = 0;
+      std::uint32_t bid_size = 0;
+      std::uint32_t ask_size = 0;
+      std::string   symbol;
+      META_REFL(seq, ts, bid, ask, bid_size, ask_size, symbol);
+   };
+
+   // tick as written by a build that added a field
+   struct tick_next {
+      std::uint64_t seq = 0;
+      std::uint64_t ts = 0;
+      double        bid = 0;
+      double        ask = 0;
+      std::uint32_t bid_size = 0;
+      std::uint32_t ask_size = 0;
+      std::string   symbol;
+      std::uint16_t venue = 0;
+      META_REFL(seq, ts, bid, ask, bid_size, ask_size, symbol, venue);
+   };
+} // ns anonymous
+
+TEST_CASE("Benchmark versioned decoding paths", "[versioned_benchmarks]") {
+   tick t{1, 2, 3.5, 3.75, 100, 200, "ACME"};
+   tick_next tn{1, 2, 3.5, 3.75, 100, 200, "ACME", 4};
+   std::vector<std::byte> same(versioned_size(t));
+   serialize_versioned(t, same);
+   std::vector<std::byte> other(versioned_size(tn));
+   serialize_versioned(tn, other);
+   std::vector<std::byte> plain(serialized_size(t));
+   serialize(t, plain);
+
+   BENCHMARK("deserialize without schema header") {
+      tick out;
+      return deserialize(out, plain);
+   };
+
+   BENCHMARK("deserialize_versioned matching schema") {
+      tick out;
+      return deserialize_versioned(out, same);
+   };
+
+   BENCHMARK("deserialize_versioned other schema") {
+      tick out;
+      return deserialize_versioned(out, other);
+   };
+}
@@ -0,0 +1,161 @@
+#include <bluegrass/meta/versioned.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   // the same message as seen by an old and a new build
+   namespace v1 {
+      struct header {
+         std::uint64_t seq = 0;
+         META_REFL(seq);
+      };
+
+      struct quote : header {
+         using super_t = header;
+         std::string   symbol;
+         double        bid = 0;
+         double        ask = 0;
+         std::uint32_t size = 0;
+         META_REFL(symbol, bid, ask, size);
+      };
+
+      struct leg {
+         std::int32_t px = 0;
+         META_REFL(px);
+      };
+
+      struct basket {
+         std::uint64_t    id = 0;
+         std::vector<leg> legs;
+         std::string      note;
+         META_REFL(id, legs, note);
+      };
+   } // ns v1
+
+   namespace v2 {
+      struct header {
+         std::uint64_t seq = 0;
+         META_REFL(seq);
+      };
+
+      // size is gone, venue is new and bid changed type
+      struct quote : header {
+         using super_t = header;
+         std::string          symbol;
+         float                bid = -1;
+         double               ask = 0;
+         std::vector<int>     venue = {7};
+         META_REFL(symbol, bid, ask, venue);
+      };
+
+      // only the element type of legs changed
+      struct leg {
+         std::int32_t px = 0;
+         std::int32_t qty = 0;
+         META_REFL(px, qty);
+      };
+
+      struct basket {
+         std::uint64_t    id = 0;
+         std::vector<leg> legs = {{1, 2}};
+         std::string      note;
+         META_REFL(id, legs, note);
+      };
+   } // ns v2
+} // ns anonymous
+
+TEST_CASE("Testing versioned serialization with a matching schema", "[versioned_fast_tests]") {
+   v1::quote q;
+   q.seq = 42;
+   q.symbol = "ACME";
+   q.bid = 10.5;
+   q.ask = 10.75;
+   q.size = 300;
+
+   std::vector<std::byte> buf(versioned_size(q));
+   REQUIRE( serialize_versioned(q, buf) == buf.size() );
+   REQUIRE( versioned_matches<v1::quote>(buf) );
+   REQUIRE( !versioned_matches<v2::quote>(buf) );
+
+   v1::quote r;
+   REQUIRE( deserialize_versioned(r, buf) == buf.size() );
+   REQUIRE( r.seq == 42 );
+   REQUIRE( r.symbol == "ACME" );
+   REQUIRE( r.bid == 10.5 );
+   REQUIRE( r.ask == 10.75 );
+   REQUIRE( r.size == 300 );
+
+   // the body is the plain serialize.hpp encoding
+   std::vector<std::byte> plain(serialized_size(q));
+   serialize(q, plain);
+   REQUIRE( std::equal(plain.begin(), plain.end(), buf.begin() + 16) );
+
+   REQUIRE_THROWS_AS( deserialize_versioned(r, span<const std::byte>(buf.data(), buf.size() - 1)), std::out_of_range );
+   std::vector<std::byte> small(buf.size() - 1);
+   REQUIRE_THROWS_AS( serialize_versioned(q, small), std::out_of_range );
+}
+
+TEST_CASE("Testing versioned serialization across schemas", "[versioned_slow_tests]") {
+   v1::quote q;
+   q.seq = 9;
+   q.symbol = "XYZ";
+   q.bid = 1.25;
+   q.ask = 1.5;
+   q.size = 10;
+
+   std::vector<std::byte> buf(versioned_size(q));
+   serialize_versioned(q, buf);
+
+   // old to new: bid was retyped so it is kept, venue is unknown to the writer so it is kept
+   v2::quote n;
+   REQUIRE( deserialize_versioned(n, buf) == buf.size() );
+   REQUIRE( n.seq == 9 );
+   REQUIRE( n.symbol == "XYZ" );
+   REQUIRE( n.bid == -1.0f );
+   REQUIRE( n.ask == 1.5 );
+   REQUIRE( n.venue == std::vector<int>{7} );
+
+   // new to old: venue is skipped, size keeps its value
+   n.venue = {1, 2, 3};
+   n.ask = 2.5;
+   std::vector<std::byte> nbuf(versioned_size(n));
+   serialize_versioned(n, nbuf);
+   v1::quote o;
+   o.size = 77;
+   REQUIRE( deserialize_versioned(o, nbuf) == nbuf.size() );
+   REQUIRE( o.seq == 9 );
+   REQUIRE( o.symbol == "XYZ" );
+   REQUIRE( o.ask == 2.5 );
+   REQUIRE( o.bid == 0 );
+   REQUIRE( o.size == 77 );
+}
+
+TEST_CASE("Testing versioned serialization with a changed element type", "[versioned_nested_tests]") {
+   v1::basket b;
+   b.id = 9;
+   b.legs = {{100}, {200}, {300}};
+   b.note = "hedge";
+
+   std::vector<std::byte> buf(versioned_size(b));
+   REQUIRE( serialize_versioned(b, buf) == buf.size() );
+   // the element layout differs, so the reader must not decode the body directly
+   REQUIRE( !versioned_matches<v2::basket>(buf) );
+
+   v2::basket r;
+   REQUIRE( deserialize_versioned(r, buf) == buf.size() );
+   REQUIRE( r.id == 9 );
+   REQUIRE( r.note == "hedge" );
+   // legs has another type in the writer, so it keeps its value
+   REQUIRE( r.legs.size() == 1 );
+   REQUIRE( r.legs[0].px == 1 );
+   REQUIRE( r.legs[0].qty == 2 );
+}
@@ -0,0 +1,108 @@
+#include <bluegrass/meta/view.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace bluegrass;
+using namespace bluegrass::meta;
+
+namespace {
+   struct header {
+      std::uint16_t kind = 0;
+      std::string   topic;
+      META_REFL(kind, topic);
+   };
+
+   struct quote {
+      header        hdr;
+      std::uint64_t id = 0;
+      double        price = 0;
+      std::string   venue;
+      std::int32_t  qty = 0;
+      META_REFL(hdr, id, price, venue, qty);
+   };
+
+   struct tagged_quote : quote {
+      using super_t = quote;
+      char tag = 0;
+      META_REFL(tag);
+   };
+} // ns anonymous
+
+TEST_CASE("Testing meta_view layout", "[view_layout_tests]") {
+   static_assert( meta_view<header>::fixed_size == 2 + 8 );
+   static_assert( meta_view<quote>::fixed_size == meta_view<header>::fixed_size + 8 + 8 + 8 + 4 );
+   static_assert( meta_view<tagged_quote>::fixed_size == meta_view<quote>::fixed_size + 1 );
+   // only strings of char get a string slot
+   static_assert( detail::is_view_string_v<std::string> );
+   static_assert( !detail::is_view_string_v<std::wstring> );
+   static_assert( !detail::is_view_string_v<std::u16string> );
+   REQUIRE( meta_view<quote>::names[3] == "venue" );
+   REQUIRE( std::is_same_v<meta_view<quote>::type<2>, double> );
+}
+
+TEST_CASE("Testing meta_view field access", "[view_access_tests]") {
+   tagged_quote q;
+   q.hdr   = {3, "equities"};
+   q.id    = 1234;
+   q.price = 99.5;
+   q.venue = "XNYS";
+   q.qty   = -20;
+   q.tag   = 'z';
+
+   std::vector<std::byte> buf(view_size(q));
+   REQUIRE( buf.size() == meta_view<tagged_quote>::fixed_size + 8 + 4 );
+   REQUIRE( write_view(q, buf) == buf.size() );
+
+   meta_view<tagged_quote> v{buf};
+   REQUIRE( v.get<0>() == 'z' );
+
+   auto base = v.super();
+   REQUIRE( base.get<1>() == 1234 );
+   REQUIRE( base.get<2>() == 99.5 );
+   REQUIRE( std::is_same_v<decltype(base.get<3>()), std::string_view> );
+   REQUIRE( base.get<3>() == "XNYS" );
+   REQUIRE( base.get<4>() == -20 );
+
+   auto hdr = base.get<0>();
+   REQUIRE( hdr.get<0>() == 3 );
+   REQUIRE( hdr.get<1>() == "equities" );
+
+   std::vector<std::byte> small(buf.size() - 1);
+   REQUIRE_THROWS_AS( write_view(q, small), std::out_of_range );
+}
+
+TEST_CASE("Testing meta_view on corrupt records", "[view_corrupt_tests]") {
+   quote q;
+   q.hdr   = {1, "fx"};
+   q.venue = "XLON";
+
+   std::vector<std::byte> buf(view_size(q));
+   write_view(q, buf);
+
+   // a buffer shorter than the fixed part is refused up front
+   REQUIRE_THROWS_AS( meta_view<quote>(span<const std::byte>{buf.data(), meta_view<quote>::fixed_size - 1}), std::out_of_range );
+
+   const std::size_t venue_slot = detail::view_offsets_v<quote>[3];
+   const auto corrupt = [&](std::uint32_t offset, std::uint32_t size) {
+      std::vector<std::byte> bad = buf;
+      const detail::view_string_slot s = { offset, size };
+      std::memcpy(bad.data() + venue_slot, &s, sizeof(s));
+      return bad;
+   };
+
+   auto past_end = corrupt(static_cast<std::uint32_t>(buf.size()), 1);
+   REQUIRE_THROWS_AS( meta_view<quote>{past_end}.get<3>(), std::out_of_range );
+   auto too_long = corrupt(meta_view<quote>::fixed_size, 0xFFFFFFFFu);
+   REQUIRE_THROWS_AS( meta_view<quote>{too_long}.get<3>(), std::out_of_range );
+   // the untouched nested string is still readable
+   REQUIRE( meta_view<quote>{too_long}.get<0>().get<1>() == "fx" );
+
+   // an empty string at the very end of the buffer is in bounds
+   auto at_end = corrupt(static_cast<std::uint32_t>(buf.size()), 0);
+   REQUIRE( meta_view<quote>{at_end}.get<3>().empty() );
+}